@@ -1,6 +1,7 @@
 #pragma once
 
 #include <vector>
+#include <algorithm>
 #include <cmath>
 #include <type_traits>
 #include <stdexcept>
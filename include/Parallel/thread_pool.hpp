@@ -0,0 +1,88 @@
+// include/Parallel/thread_pool.hpp
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace mlpp::parallel
+{
+
+/**
+ * Number of hardware threads, at least 1.
+ */
+[[nodiscard]]
+std::size_t hardware_threads() noexcept;
+
+/**
+ * Resolve a user-facing thread-count knob: 0 means all hardware
+ * threads, anything else is taken as is.
+ */
+[[nodiscard]]
+std::size_t resolve_threads(std::size_t requested) noexcept;
+
+/**
+ * Fixed-size pool of worker threads with a shared FIFO task queue.
+ *
+ * parallel_for() lets the calling thread take part in the loop, so a
+ * pool with w workers runs it on w + 1 threads, and a pool with no
+ * workers degrades to a plain serial loop. Because the caller never
+ * blocks on a task that has not started, parallel_for() may be nested
+ * inside tasks of the same pool without deadlocking.
+ */
+class ThreadPool
+{
+public:
+    /**
+     * @param workers  Number of worker threads (may be 0)
+     */
+    explicit ThreadPool(std::size_t workers);
+
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * Number of worker threads.
+     */
+    [[nodiscard]]
+    std::size_t size() const noexcept;
+
+    /**
+     * Enqueue a task and return a future for its result.
+     */
+    template <typename F>
+    auto submit(F&& f) -> std::future<std::invoke_result_t<std::decay_t<F>>>;
+
+    /**
+     * Call fn(k) for every k in [0, count), distributing indices
+     * dynamically over the workers and the calling thread.
+     *
+     * Blocks until every call has returned. The first exception
+     * thrown by fn is rethrown on the calling thread.
+     */
+    template <typename F>
+    void parallel_for(std::size_t count, F&& fn);
+
+private:
+    void worker_loop();
+
+private:
+    std::vector<std::thread> workers_;
+    std::deque<std::function<void()>> tasks_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool stop_ = false;
+};
+
+} // namespace mlpp::parallel
+
+#include "thread_pool.inl"
@@ -0,0 +1,171 @@
+// include/Parallel/thread_pool.inl
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+
+#include "thread_pool.hpp"
+
+namespace mlpp::parallel
+{
+
+inline std::size_t
+hardware_threads() noexcept
+{
+    return std::max<std::size_t>(1, std::thread::hardware_concurrency());
+}
+
+inline std::size_t
+resolve_threads(std::size_t requested) noexcept
+{
+    return requested == 0 ? hardware_threads() : requested;
+}
+
+inline
+ThreadPool::ThreadPool(std::size_t workers)
+{
+    workers_.reserve(workers);
+
+    for (std::size_t w = 0; w < workers; ++w)
+        workers_.emplace_back([this] { worker_loop(); });
+}
+
+inline
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+
+    cv_.notify_all();
+
+    for (std::thread& t : workers_)
+        t.join();
+}
+
+inline std::size_t
+ThreadPool::size() const noexcept
+{
+    return workers_.size();
+}
+
+inline void
+ThreadPool::worker_loop()
+{
+    for (;;)
+    {
+        std::function<void()> task;
+
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cv_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
+
+            if (tasks_.empty())
+                return;
+
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+
+        task();
+    }
+}
+
+template <typename F>
+inline auto
+ThreadPool::submit(F&& f) -> std::future<std::invoke_result_t<std::decay_t<F>>>
+{
+    using Result = std::invoke_result_t<std::decay_t<F>>;
+
+    // std::function needs a copyable target; packaged_task is move-only.
+    auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(f));
+    std::future<Result> future = task->get_future();
+
+    if (workers_.empty())
+    {
+        (*task)();
+        return future;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        tasks_.emplace_back([task] { (*task)(); });
+    }
+
+    cv_.notify_one();
+    return future;
+}
+
+template <typename F>
+inline void
+ThreadPool::parallel_for(std::size_t count, F&& fn)
+{
+    if (count == 0)
+        return;
+
+    // Shared with helper tasks, which may start after the loop is over.
+    struct State
+    {
+        std::atomic<std::size_t> next{0};
+        std::atomic<std::size_t> done{0};
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::exception_ptr error;
+    };
+
+    auto state = std::make_shared<State>();
+    auto body = std::make_shared<std::decay_t<F>>(std::forward<F>(fn));
+
+    const auto run = [state, body, count]
+    {
+        for (;;)
+        {
+            const std::size_t k = state->next.fetch_add(1);
+            if (k >= count)
+                return;
+
+            try
+            {
+                (*body)(k);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                if (!state->error)
+                    state->error = std::current_exception();
+            }
+
+            if (state->done.fetch_add(1) + 1 == count)
+            {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                state->cv.notify_all();
+            }
+        }
+    };
+
+    const std::size_t helpers = std::min(workers_.size(), count - 1);
+
+    if (helpers > 0)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (std::size_t h = 0; h < helpers; ++h)
+                tasks_.emplace_back(run);
+        }
+
+        cv_.notify_all();
+    }
+
+    run();
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->cv.wait(lock, [&] { return state->done.load() == count; });
+
+    if (state->error)
+        std::rethrow_exception(state->error);
+}
+
+} // namespace mlpp::parallel
@@ -0,0 +1,187 @@
+// include/Supervised Learning/Classifiers/SVM/Kernel Perceptron/budget_perceptron.hpp
+#pragma once
+
+#include "../Kernel/kernel.hpp"
+#include "../Kernel/kernel_cache.hpp"
+
+#include <Eigen/Dense>
+#include <vector>
+#include <cstddef>
+
+namespace mlpp::classifiers
+{
+
+/**
+ * What BudgetPerceptron does when a mistake would exceed the budget.
+ */
+enum class BudgetPolicy
+{
+    // Drop the oldest support vector (the removal step of the Forgetron).
+    remove_oldest,
+
+    // Drop the support vector whose term |β_s| √k(x_s, x_s) is smallest.
+    remove_smallest,
+
+    // Project the new point onto the span of the support set (Projectron).
+    project
+};
+
+/**
+ * Training configuration for BudgetPerceptron.
+ */
+struct BudgetPerceptronOptions
+{
+    // Maximum number of support vectors (0 = unbounded).
+    std::size_t budget = 0;
+
+    BudgetPolicy policy = BudgetPolicy::remove_oldest;
+
+    /**
+     * Projectron threshold η (project policy only).
+     *
+     * A mistake is projected instead of added whenever the squared
+     * projection error δ² is at most η, even below the budget. Must be
+     * positive so that the inverse Gram matrix stays well conditioned.
+     */
+    double projection_threshold = 1e-8;
+
+    // Passes over the data in fit().
+    std::size_t max_epochs = 100;
+
+    /**
+     * Kernel cache budget in bytes used by fit().
+     *
+     * 0 keeps the kernel row of each support vector taken from the
+     * dataset only while it is in the support set: (size() + 1) × n
+     * values, so at most (budget + 1) × n under a budget. Any other
+     * value reads rows from a bounded cache as in
+     * SVMOptions::cache_bytes.
+     */
+    std::size_t cache_bytes = 0;
+};
+
+/**
+ * Online kernel perceptron with a bounded support set.
+ *
+ *   f(x) = Σ_s β_s k(x_s, x),   predict(x) = sign f(x)
+ *
+ * On a mistake (y f(x) ≤ 0) the point is added with β = y. Once the
+ * support set holds `budget` points, a mistake first removes one of
+ * them, or for the project policy updates β ← β + y K_SS⁻¹ k_S(x)
+ * without growing the set (Orabona, Keshet & Caputo 2009). K_SS⁻¹ is
+ * kept up to date in O(budget²) per insertion.
+ *
+ * The model owns copies of its support vectors, so partial_fit() can
+ * consume samples one at a time from a stream at O(budget) kernel
+ * evaluations each.
+ *
+ * fit() makes repeated passes over a stored dataset. It keeps the
+ * decision value f(x_i) of every sample and updates all of them when
+ * a coefficient changes, reading the kernel rows of the current
+ * support vectors, which it keeps only while they are in the set. A
+ * pass with few mistakes therefore costs O(n) instead of
+ * O(n · budget) kernel evaluations.
+ *
+ * @tparam KernelT  Kernel evaluator, see BasicKernelCache.
+ */
+template <kernel::KernelEvaluator KernelT>
+class BasicBudgetPerceptron
+{
+public:
+    explicit BasicBudgetPerceptron(KernelT kernel,
+                                   BudgetPerceptronOptions options = {});
+
+    /**
+     * Process one sample.
+     *
+     * @param x  Sample
+     * @param y  Label in {−1, +1}
+     * @return True if the sample was a mistake and the model changed.
+     */
+    bool partial_fit(const kernel::Vector& x, int y);
+
+    /**
+     * Run up to max_epochs passes over (X, y), stopping after the
+     * first pass without mistakes. Continues from the current model.
+     */
+    void fit(const std::vector<kernel::Vector>& X,
+             const std::vector<int>& y);
+
+    /**
+     * Evaluate f(x) = Σ_s β_s k(x_s, x).
+     */
+    [[nodiscard]]
+    double decision(const kernel::Vector& x) const;
+
+    /**
+     * Predict class label (+1 or −1).
+     */
+    [[nodiscard]]
+    int predict(const kernel::Vector& x) const;
+
+    /**
+     * Number of support vectors.
+     */
+    [[nodiscard]]
+    std::size_t size() const noexcept;
+
+    [[nodiscard]]
+    const std::vector<kernel::Vector>& support_vectors() const noexcept;
+
+    // Coefficients β_s, one per support vector.
+    [[nodiscard]]
+    const std::vector<double>& coefficients() const noexcept;
+
+    // Mistakes made since construction.
+    [[nodiscard]]
+    std::size_t mistakes() const noexcept;
+
+private:
+    /**
+     * Apply the update for a mistake on (x, y).
+     *
+     * @param k         k(x_s, x) for every support vector s; only
+     *                  read by the project policy.
+     * @param source    Kernel row of x in fit(), or npos.
+     * @param on_change Called as on_change(s, Δβ) before support
+     *                  vector s changes (before it is erased, or
+     *                  after it is appended).
+     */
+    template <typename OnChange>
+    void learn(const kernel::Vector& x,
+               int y,
+               const Eigen::VectorXd& k,
+               std::size_t source,
+               OnChange&& on_change);
+
+    /**
+     * Support vector to remove for the removal policies.
+     */
+    std::size_t victim() const noexcept;
+
+    void erase(std::size_t s);
+
+private:
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    KernelT kernel_;
+    BudgetPerceptronOptions options_;
+
+    std::vector<kernel::Vector> sv_;
+    std::vector<double> beta_;
+    std::vector<double> self_;          // k(x_s, x_s)
+    std::vector<std::size_t> source_;   // kernel row during fit(), or npos
+
+    Eigen::MatrixXd inverse_;           // K_SS⁻¹, project policy only
+
+    std::size_t mistakes_ = 0;
+};
+
+/**
+ * Runtime-polymorphic budget perceptron.
+ */
+using BudgetPerceptron = BasicBudgetPerceptron<kernel::KernelFunction>;
+
+} // namespace mlpp::classifiers
+
+#include "budget_perceptron.inl"
@@ -0,0 +1,332 @@
+// include/Supervised Learning/Classifiers/SVM/Kernel Perceptron/budget_perceptron.inl
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+#include "budget_perceptron.hpp"
+
+namespace mlpp::classifiers
+{
+
+template <kernel::KernelEvaluator KernelT>
+inline
+BasicBudgetPerceptron<KernelT>::BasicBudgetPerceptron(KernelT kernel,
+                                                      BudgetPerceptronOptions options)
+    : kernel_(std::move(kernel)),
+      options_(options)
+{
+    if (options_.policy == BudgetPolicy::project &&
+        !(options_.projection_threshold > 0.0))
+        throw std::invalid_argument(
+            "BudgetPerceptron: projection_threshold must be positive");
+}
+
+template <kernel::KernelEvaluator KernelT>
+inline std::size_t
+BasicBudgetPerceptron<KernelT>::victim() const noexcept
+{
+    if (options_.policy == BudgetPolicy::remove_oldest)
+        return 0;
+
+    std::size_t best = 0;
+    double best_norm = std::abs(beta_[0]) * std::sqrt(self_[0]);
+
+    for (std::size_t s = 1; s < sv_.size(); ++s)
+    {
+        const double norm = std::abs(beta_[s]) * std::sqrt(self_[s]);
+
+        if (norm < best_norm)
+        {
+            best = s;
+            best_norm = norm;
+        }
+    }
+
+    return best;
+}
+
+template <kernel::KernelEvaluator KernelT>
+inline void
+BasicBudgetPerceptron<KernelT>::erase(std::size_t s)
+{
+    const auto at = static_cast<std::ptrdiff_t>(s);
+
+    sv_.erase(sv_.begin() + at);
+    beta_.erase(beta_.begin() + at);
+    self_.erase(self_.begin() + at);
+    source_.erase(source_.begin() + at);
+}
+
+template <kernel::KernelEvaluator KernelT>
+template <typename OnChange>
+inline void
+BasicBudgetPerceptron<KernelT>::learn(const kernel::Vector& x,
+                                      int y,
+                                      const Eigen::VectorXd& k,
+                                      std::size_t source,
+                                      OnChange&& on_change)
+{
+    const double kxx = kernel_(x, x);
+    const std::size_t m = sv_.size();
+    const bool full = options_.budget != 0 && m >= options_.budget;
+
+    if (options_.policy == BudgetPolicy::project)
+    {
+        if (m == 0 && kxx <= options_.projection_threshold)
+            return;
+
+        if (m > 0)
+        {
+            // d = K_SS⁻¹ k_S(x),  δ² = k(x, x) − k_S(x)ᵀ d
+            const Eigen::VectorXd d = inverse_ * k;
+            const double delta2 = kxx - k.dot(d);
+
+            if (full || delta2 <= options_.projection_threshold)
+            {
+                for (std::size_t s = 0; s < m; ++s)
+                {
+                    const double step = y * d(static_cast<Eigen::Index>(s));
+                    beta_[s] += step;
+                    on_change(s, step);
+                }
+
+                return;
+            }
+
+            // Block inverse of [K_SS k; kᵀ k(x, x)] via the Schur complement δ².
+            const auto e = static_cast<Eigen::Index>(m);
+            const double inv = 1.0 / delta2;
+
+            inverse_.conservativeResize(e + 1, e + 1);
+            inverse_.topLeftCorner(e, e).noalias() += inv * d * d.transpose();
+            inverse_.topRightCorner(e, 1) = -inv * d;
+            inverse_.bottomLeftCorner(1, e) = -inv * d.transpose();
+            inverse_(e, e) = inv;
+        }
+        else
+        {
+            inverse_ = Eigen::MatrixXd::Constant(1, 1, 1.0 / kxx);
+        }
+    }
+    else if (full)
+    {
+        const std::size_t s = victim();
+        on_change(s, -beta_[s]);
+        erase(s);
+    }
+
+    sv_.push_back(x);
+    beta_.push_back(static_cast<double>(y));
+    self_.push_back(kxx);
+    source_.push_back(source);
+
+    on_change(sv_.size() - 1, static_cast<double>(y));
+}
+
+template <kernel::KernelEvaluator KernelT>
+inline bool
+BasicBudgetPerceptron<KernelT>::partial_fit(const kernel::Vector& x, int y)
+{
+    const std::size_t m = sv_.size();
+
+    Eigen::VectorXd k(static_cast<Eigen::Index>(m));
+    double f = 0.0;
+
+    for (std::size_t s = 0; s < m; ++s)
+    {
+        k(static_cast<Eigen::Index>(s)) = kernel_(sv_[s], x);
+        f += beta_[s] * k(static_cast<Eigen::Index>(s));
+    }
+
+    if (y * f > 0.0)
+        return false;
+
+    ++mistakes_;
+    learn(x, y, k, npos, [](std::size_t, double) {});
+
+    return true;
+}
+
+template <kernel::KernelEvaluator KernelT>
+inline void
+BasicBudgetPerceptron<KernelT>::fit(const std::vector<kernel::Vector>& X,
+                                    const std::vector<int>& y)
+{
+    if (X.size() != y.size())
+        throw std::invalid_argument("BudgetPerceptron::fit: size mismatch");
+
+    const std::size_t n = X.size();
+
+    // With a cache budget, rows come from a bounded cache and source_
+    // holds dataset indices. Otherwise each support vector taken from X
+    // owns a slot of n kernel values while it stays in the support set,
+    // so at most budget + 1 rows are held, and source_ holds slots.
+    std::optional<kernel::BasicKernelCache<KernelT>> cache;
+    if (options_.cache_bytes != 0)
+        cache.emplace(X, kernel_, options_.cache_bytes);
+
+    std::vector<double> rows;            // slots × n, row-major
+    std::vector<std::size_t> sample;     // dataset index of each slot
+    std::vector<char> ready;             // row of the slot computed
+    std::vector<char> used;              // slot held by a support vector
+
+    const auto row = [&](std::size_t key) -> const double*
+    {
+        if (cache)
+            return cache->row(key);
+
+        double* K = rows.data() + key * n;
+        if (!ready[key])
+        {
+            for (std::size_t j = 0; j < n; ++j)
+                K[j] = kernel_(X[sample[key]], X[j]);
+            ready[key] = 1;
+        }
+
+        return K;
+    };
+
+    // Support vectors from earlier calls are not rows of X.
+    source_.assign(sv_.size(), npos);
+
+    // f_i = f(x_i), refreshed whenever a coefficient changes.
+    std::vector<double> f(n, 0.0);
+
+    const auto shift = [&](std::size_t s, double delta)
+    {
+        if (delta == 0.0)
+            return;
+
+        if (source_[s] != npos)
+        {
+            const double* K = row(source_[s]);
+            for (std::size_t j = 0; j < n; ++j)
+                f[j] += delta * K[j];
+        }
+        else
+        {
+            for (std::size_t j = 0; j < n; ++j)
+                f[j] += delta * kernel_(sv_[s], X[j]);
+        }
+    };
+
+    for (std::size_t s = 0; s < sv_.size(); ++s)
+        shift(s, beta_[s]);
+
+    Eigen::VectorXd k;
+
+    for (std::size_t epoch = 0; epoch < options_.max_epochs; ++epoch)
+    {
+        bool any_update = false;
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            if (y[i] * f[i] > 0.0)
+                continue;
+
+            if (options_.policy == BudgetPolicy::project)
+            {
+                k.resize(static_cast<Eigen::Index>(sv_.size()));
+
+                for (std::size_t s = 0; s < sv_.size(); ++s)
+                {
+                    k(static_cast<Eigen::Index>(s)) =
+                        source_[s] != npos ? row(source_[s])[i]
+                                           : kernel_(sv_[s], X[i]);
+                }
+            }
+
+            ++mistakes_;
+            any_update = true;
+
+            std::size_t key = i;
+
+            if (!cache)
+            {
+                // A free slot; its row is computed once x_i joins the set.
+                key = static_cast<std::size_t>(std::find(used.begin(), used.end(), 0) -
+                                               used.begin());
+                if (key == used.size())
+                {
+                    used.push_back(0);
+                    ready.push_back(0);
+                    sample.push_back(0);
+                    rows.resize(rows.size() + n);
+                }
+
+                sample[key] = i;
+                ready[key] = 0;
+            }
+
+            learn(X[i], y[i], k, key, shift);
+
+            if (!cache)
+            {
+                std::fill(used.begin(), used.end(), 0);
+                for (std::size_t src : source_)
+                {
+                    if (src != npos)
+                        used[src] = 1;
+                }
+            }
+        }
+
+        if (!any_update)
+            break;
+    }
+
+    source_.assign(sv_.size(), npos);
+}
+
+template <kernel::KernelEvaluator KernelT>
+inline double
+BasicBudgetPerceptron<KernelT>::decision(const kernel::Vector& x) const
+{
+    double sum = 0.0;
+
+    for (std::size_t s = 0; s < sv_.size(); ++s)
+        sum += beta_[s] * kernel_(sv_[s], x);
+
+    return sum;
+}
+
+template <kernel::KernelEvaluator KernelT>
+inline int
+BasicBudgetPerceptron<KernelT>::predict(const kernel::Vector& x) const
+{
+    return decision(x) >= 0.0 ? 1 : -1;
+}
+
+template <kernel::KernelEvaluator KernelT>
+inline std::size_t
+BasicBudgetPerceptron<KernelT>::size() const noexcept
+{
+    return sv_.size();
+}
+
+template <kernel::KernelEvaluator KernelT>
+inline const std::vector<kernel::Vector>&
+BasicBudgetPerceptron<KernelT>::support_vectors() const noexcept
+{
+    return sv_;
+}
+
+template <kernel::KernelEvaluator KernelT>
+inline const std::vector<double>&
+BasicBudgetPerceptron<KernelT>::coefficients() const noexcept
+{
+    return beta_;
+}
+
+template <kernel::KernelEvaluator KernelT>
+inline std::size_t
+BasicBudgetPerceptron<KernelT>::mistakes() const noexcept
+{
+    return mistakes_;
+}
+
+} // namespace mlpp::classifiers
@@ -1,7 +1,8 @@
 #pragma once
 
-#include "../Kernel/Kernel.hpp"
+#include "../Kernel/kernel.hpp"
 #include "../Kernel/kernel_cache.hpp"
+#include "../support_vector_model.hpp"
 
 #include <vector>
 #include <cstddef>
@@ -16,6 +17,10 @@ namespace mlpp::classifiers
  *
  *   f(x) = sign( sum_i α_i y_i k(x_i, x) )
  *
+ * fit() keeps the running margins f(x_i) of all samples and adds one
+ * kernel row to them per mistake, so a pass costs O(n) plus O(n) per
+ * mistake. Prediction goes through a compact model that holds only
+ * the samples with α_i > 0.
  */
 class KernelPerceptron
 {
@@ -27,12 +32,24 @@ public:
 
     void fit();
 
+    [[nodiscard]]
+    double decision(const kernel::Vector& x) const;
+
     [[nodiscard]]
     int predict(const kernel::Vector& x) const;
 
+    /**
+     * Compact model over the samples with α_i > 0, rebuilt by fit().
+     */
+    [[nodiscard]]
+    const kernel::SupportVectorModel& model() const noexcept;
+
     [[nodiscard]]
     std::size_t mistakes() const noexcept;
 
+private:
+    void finalize();
+
 private:
     const std::vector<kernel::Vector>& X_;
     const std::vector<int>& y_;
@@ -42,6 +59,10 @@ private:
     std::vector<double> alpha_;
     std::size_t max_epochs_;
     std::size_t mistakes_;
+
+    kernel::SupportVectorModel model_;
 };
 
 } // namespace mlpp::classifiers
+
+#include "kernel_perceptron.inl"
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+
 #include "kernel_perceptron.hpp"
 
 namespace mlpp::classifiers
@@ -25,51 +27,91 @@ KernelPerceptron::fit()
     const std::size_t n = X_.size();
     mistakes_ = 0;
 
+    // margin[i] = Σ_j α_j y_j K(j, i), one kernel row per nonzero α_j.
+    std::vector<double> margin(n, 0.0);
+
+    const auto add_row = [&](std::size_t j, double c)
+    {
+        const double* K = cache_.row(j);
+
+        for (std::size_t t = 0; t < n; ++t)
+            margin[t] += c * K[t];
+    };
+
+    for (std::size_t j = 0; j < n; ++j)
+    {
+        if (alpha_[j] != 0.0)
+            add_row(j, alpha_[j] * y_[j]);
+    }
+
     for (std::size_t epoch = 0; epoch < max_epochs_; ++epoch)
     {
         bool any_update = false;
 
         for (std::size_t i = 0; i < n; ++i)
         {
-            double decision = 0.0;
-
-            for (std::size_t j = 0; j < n; ++j)
-            {
-                if (alpha_[j] != 0.0)
-                {
-                    decision += alpha_[j] * y_[j] * cache_(j, i);
-                }
-            }
-
-            if (y_[i] * decision <= 0.0)
+            if (y_[i] * margin[i] <= 0.0)
             {
                 alpha_[i] += 1.0;
                 ++mistakes_;
                 any_update = true;
+
+                add_row(i, y_[i]);
             }
         }
 
         if (!any_update)
             break;
     }
+
+    finalize();
 }
 
-inline int
-KernelPerceptron::predict(const kernel::Vector& x) const
+inline void
+KernelPerceptron::finalize()
 {
-    double sum = 0.0;
     const std::size_t n = X_.size();
+    const std::size_t dim = X_.empty() ? 0 : X_.front().size();
 
+    std::vector<std::size_t> sv;
     for (std::size_t i = 0; i < n; ++i)
     {
         if (alpha_[i] != 0.0)
-        {
-            sum += alpha_[i] * y_[i] *
-                   cache_.kernel()(X_[i], x);
-        }
+            sv.push_back(i);
     }
 
-    return sum >= 0.0 ? 1 : -1;
+    kernel::SupportVectorModel::RowMatrix vectors(sv.size(), dim);
+    Eigen::VectorXd coef(sv.size());
+
+    for (std::size_t r = 0; r < sv.size(); ++r)
+    {
+        const kernel::Vector& x = X_[sv[r]];
+        std::copy(x.begin(), x.end(), vectors.row(r).data());
+        coef(r) = alpha_[sv[r]] * y_[sv[r]];
+    }
+
+    model_ = kernel::SupportVectorModel(std::move(vectors),
+                                        std::move(coef),
+                                        0.0,
+                                        cache_.kernel());
+}
+
+inline double
+KernelPerceptron::decision(const kernel::Vector& x) const
+{
+    return model_.decision(x);
+}
+
+inline int
+KernelPerceptron::predict(const kernel::Vector& x) const
+{
+    return model_.predict(x);
+}
+
+inline const kernel::SupportVectorModel&
+KernelPerceptron::model() const noexcept
+{
+    return model_;
 }
 
 inline std::size_t
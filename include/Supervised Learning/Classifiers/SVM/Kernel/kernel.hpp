@@ -1,5 +1,6 @@
 // include/Supervised Learning/Classifiers/SVM/Kernel/kernel.hpp
 #pragma once
+#include <concepts>
 #include <vector>
 #include <memory>
 #include <cstddef>
@@ -18,6 +19,17 @@ public:
     virtual double operator()(const Vector& x,
                               const Vector& y) const noexcept = 0;
 
+    /**
+     * Evaluate on raw contiguous buffers of length dim.
+     *
+     * The default copies into Vectors; concrete kernels override it
+     * so callers holding packed rows avoid the copy.
+     */
+    [[nodiscard]]
+    virtual double evaluate(const double* x,
+                            const double* y,
+                            std::size_t dim) const;
+
     [[nodiscard]]
     virtual std::unique_ptr<Kernel> clone() const = 0;
 };
@@ -45,13 +57,43 @@ public:
     double operator()(const Vector& x,
                       const Vector& y) const noexcept;
 
+    [[nodiscard]]
+    double evaluate(const double* x,
+                    const double* y,
+                    std::size_t dim) const;
+
     [[nodiscard]]
     bool valid() const noexcept;
 
+    /**
+     * Access the held kernel if it is of type K, nullptr otherwise.
+     *
+     * Lets callers switch to a specialised path (e.g. blocked matrix
+     * products) for kernels they recognise.
+     */
+    template <typename K>
+    [[nodiscard]]
+    const K* target() const noexcept;
+
 private:
     std::unique_ptr<Kernel> impl_;
 };
 
+/**
+ * Kernel evaluator accepted by the templated SVM components.
+ *
+ * Satisfied by KernelFunction (runtime dispatch) and by the
+ * static_kernel types (compile-time composition).
+ */
+template <typename K>
+concept KernelEvaluator =
+    std::copy_constructible<K> &&
+    requires(const K& k, const Vector& x, const double* p, std::size_t dim)
+    {
+        { k(x, x) } -> std::convertible_to<double>;
+        { k.evaluate(p, p, dim) } -> std::convertible_to<double>;
+    };
+
 } // namespace mlpp::classifiers::kernel
 
 #include "kernel.inl"
\ No newline at end of file
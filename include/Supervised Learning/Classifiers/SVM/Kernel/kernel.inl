@@ -6,6 +6,14 @@
 namespace mlpp::classifiers::kernel
 {
 
+inline double
+Kernel::evaluate(const double* x,
+                 const double* y,
+                 std::size_t dim) const
+{
+    return (*this)(Vector(x, x + dim), Vector(y, y + dim));
+}
+
 inline KernelFunction::KernelFunction(const KernelFunction& other)
 {
     if (other.impl_)
@@ -35,10 +43,25 @@ KernelFunction::operator()(const Vector& x,
     return (*impl_)(x, y);
 }
 
+inline double
+KernelFunction::evaluate(const double* x,
+                         const double* y,
+                         std::size_t dim) const
+{
+    return impl_->evaluate(x, y, dim);
+}
+
 inline bool
 KernelFunction::valid() const noexcept
 {
     return static_cast<bool>(impl_);
 }
 
+template <typename K>
+inline const K*
+KernelFunction::target() const noexcept
+{
+    return dynamic_cast<const K*>(impl_.get());
+}
+
 } // namespace mlpp::classifiers::kernel
\ No newline at end of file
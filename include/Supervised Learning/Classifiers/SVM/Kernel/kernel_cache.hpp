@@ -4,15 +4,38 @@
 #include "kernel.hpp"
 
 #include <Eigen/Dense>
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <list>
 #include <vector>
 #include <cstddef>
 
 namespace mlpp::classifiers::kernel
 {
 
+/**
+ * @brief Storage layout of an unbounded kernel cache.
+ */
+enum class CacheLayout
+{
+    // Full n × n matrix; rows are returned in place.
+    full,
+
+    // Upper triangle only, n (n + 1) / 2 entries; rows are gathered.
+    packed
+};
+
 /**
  * @brief Kernel (Gram) matrix cache.
  *
+ * @tparam KernelT  Kernel evaluator. KernelFunction (the KernelCache
+ *                  alias) dispatches at runtime; a static_kernel type
+ *                  lets the compiler inline every evaluation.
+ * @tparam Scalar   Storage type of cached entries. float halves the
+ *                  memory per entry; kernel values are still computed
+ *                  in double, and SMOSolver accumulates in double.
+ *
  * This class stores and manages evaluations of the kernel-induced
  * Gram matrix
  *
@@ -23,11 +46,28 @@ namespace mlpp::classifiers::kernel
  * The cache supports lazy evaluation, symmetric storage, and
  * full precomputation. Internally, evaluations are stored in
  * an Eigen dense matrix for efficient numerical access.
+ *
+ * For datasets whose Gram matrix does not fit in memory the cache
+ * can instead run in a bounded mode: whole kernel rows are computed
+ * on demand and kept in a pool limited by a memory budget, evicting
+ * the least recently used row when the pool is full (as in LIBSVM).
+ * Memory then grows as O(budget + n) instead of O(n²).
+ *
+ * The packed layout keeps only K_ij, i ≤ j, in row-major order with
+ * one computed bit per entry, about a quarter of the full layout's
+ * n² (sizeof(Scalar) + 1) bytes for doubles. Rows are then not
+ * contiguous in memory: row() gathers them into one of two buffers,
+ * so again the two most recently returned rows stay valid together.
+ *
+ * Lazy evaluation writes through const accessors, so a cache may only
+ * be read from several threads after precompute(). Use
+ * BasicSharedKernelCache to share lazily filled rows between threads.
  */
-class KernelCache
+template <KernelEvaluator KernelT, std::floating_point Scalar = double>
+class BasicKernelCache
 {
 public:
-    using Matrix = Eigen::MatrixXd;
+    using Matrix = Eigen::Matrix<Scalar, Eigen::Dynamic, Eigen::Dynamic>;
 
     /**
      * @brief Construct a kernel cache for a dataset and kernel.
@@ -35,8 +75,36 @@ public:
      * @param data    Input samples
      * @param kernel  Kernel function
      */
-    KernelCache(const std::vector<Vector>& data,
-                KernelFunction kernel);
+    BasicKernelCache(const std::vector<Vector>& data,
+                     KernelT kernel);
+
+    /**
+     * @brief Construct an unbounded cache with the given layout.
+     *
+     * @param data    Input samples
+     * @param kernel  Kernel function
+     * @param layout  Full or packed (upper-triangular) storage
+     */
+    BasicKernelCache(const std::vector<Vector>& data,
+                     KernelT kernel,
+                     CacheLayout layout);
+
+    /**
+     * @brief Construct a row-bounded kernel cache.
+     *
+     * At most max(2, cache_bytes / (n · sizeof(Scalar) + ⌈n / 64⌉ · 8))
+     * rows are resident at once (each row carries a computed-entry
+     * bitmap).
+     * Since at least two rows are always kept, the two rows most
+     * recently returned by row() remain valid together.
+     *
+     * @param data         Input samples
+     * @param kernel       Kernel function
+     * @param cache_bytes  Memory budget for cached rows, in bytes
+     */
+    BasicKernelCache(const std::vector<Vector>& data,
+                     KernelT kernel,
+                     std::size_t cache_bytes);
 
     /**
      * @brief Return the number of samples.
@@ -53,24 +121,98 @@ public:
     double operator()(std::size_t i,
                       std::size_t j) const;
 
+    /**
+     * @brief Access a full Gram matrix row.
+     *
+     * Returns a pointer to n contiguous values K_{i0}, ..., K_{i,n-1}.
+     * In bounded mode the row is computed as a whole on a miss and the
+     * pointer stays valid until the row is evicted.
+     */
+    [[nodiscard]]
+    const Scalar* row(std::size_t i) const;
+
+    /**
+     * @brief Access a partially evaluated Gram matrix row.
+     *
+     * Same as row(i), but only the entries K_{it} with t in @p subset
+     * are guaranteed to be computed. Used by the shrinking solver to
+     * avoid kernel evaluations against inactive variables.
+     */
+    [[nodiscard]]
+    const Scalar* row(std::size_t i,
+                      const std::vector<std::size_t>& subset) const;
+
+    /**
+     * @brief Whether the cache runs in row-bounded (LRU) mode.
+     */
+    [[nodiscard]]
+    bool bounded() const noexcept;
+
+    /**
+     * @brief Whether the cache stores only the upper triangle.
+     */
+    [[nodiscard]]
+    bool packed() const noexcept;
+
+    /**
+     * @brief Maximum number of resident rows (n in dense mode).
+     */
+    [[nodiscard]]
+    std::size_t capacity() const noexcept;
+
     /**
      * @brief Access the full Gram matrix.
      *
      * Ensures that all entries are computed before returning.
+     * Not available in bounded or packed mode.
      */
     [[nodiscard]]
     const Matrix& gram_matrix() const;
 
     /**
      * @brief Force computation of all kernel evaluations.
+     *
+     * The upper triangle is split into precompute_tile × precompute_tile
+     * blocks that are evaluated in parallel and, in the full layout,
+     * mirrored afterwards.
+     * Every entry is computed by exactly one kernel call, so the result
+     * does not depend on the thread count.
+     *
+     * No-op in bounded mode, where rows are only computed on demand.
+     *
+     * Afterwards the full cache is never written again, so any number
+     * of threads may read entries and rows concurrently. Packed rows
+     * are still gathered into shared buffers and need one cache per
+     * thread, or SubsetGram views that read entries only.
+     *
+     * @param threads  Number of threads (0 = all hardware threads)
+     */
+    void precompute(std::size_t threads = 0) const;
+
+    /**
+     * @brief Extend the cache to samples appended to the dataset.
+     *
+     * Call after the last @p count samples have been added to the
+     * dataset. Entries among the existing samples are kept; only the
+     * rows and columns of the new samples are left to compute.
      */
-    void precompute() const;
+    void append(std::size_t count);
+
+    /**
+     * @brief Drop samples that were erased from the dataset.
+     *
+     * Call after the samples at @p indices (positions before the
+     * erase) have been removed from the dataset. Entries among the
+     * remaining samples are kept and moved to their new positions;
+     * in bounded mode, resident rows of erased samples are released.
+     */
+    void remove(const std::vector<std::size_t>& indices);
 
     /**
      * @brief Access the underlying kernel function.
      */
     [[nodiscard]]
-    const KernelFunction& kernel() const noexcept;
+    const KernelT& kernel() const noexcept;
 
 private:
     /**
@@ -82,14 +224,105 @@ private:
     void compute_entry(std::size_t i,
                        std::size_t j) const;
 
+    /**
+     * @brief Position of K_ij, i ≤ j, in a packed triangle of n rows.
+     */
+    static std::size_t packed_index(std::size_t n,
+                                    std::size_t i,
+                                    std::size_t j) noexcept;
+
+    /**
+     * @brief Packed entry K_ij (any order), computed if needed.
+     */
+    Scalar packed_entry(std::size_t i,
+                        std::size_t j) const;
+
+    /**
+     * @brief Gather the requested entries of row i into a row buffer.
+     *
+     * Reuses the buffer already holding row i, otherwise the one that
+     * was not returned last.
+     */
+    template <typename Columns>
+    const Scalar* gather_row(std::size_t i,
+                             const Columns& columns) const;
+
+    /**
+     * @brief Return the pool slot holding row i.
+     *
+     * Marks row i as most recently used and evicts the least recently
+     * used row if the pool is full. A newly assigned slot starts with
+     * no computed entries.
+     */
+    std::size_t fetch_row(std::size_t i) const;
+
+    bool filled(std::size_t slot, std::size_t j) const noexcept;
+    void set_filled(std::size_t slot, std::size_t j) const noexcept;
+
+    /**
+     * @brief Move cached entries to a new sample numbering.
+     *
+     * @p source[k] is the previous index of sample k, or npos for a
+     * sample that has nothing cached yet.
+     */
+    void reindex(const std::vector<std::size_t>& source);
+
+    /**
+     * @brief Number of samples the cached entries refer to.
+     */
+    std::size_t cached_size() const noexcept;
+
+    /**
+     * @brief Row pool size for n samples under a byte budget.
+     */
+    static std::size_t pool_capacity(std::size_t n,
+                                     std::size_t cache_bytes) noexcept;
+
+    static std::size_t bit_words(std::size_t bits) noexcept;
+
 private:
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    // Rows/columns per precompute block.
+    static constexpr std::size_t precompute_tile = 64;
+
     const std::vector<Vector>& data_;
-    KernelFunction kernel_;
+    KernelT kernel_;
 
     mutable Matrix gram_;
     mutable Eigen::ArrayXX<bool> computed_;
+    mutable bool complete_ = false;           // set by precompute()
+
+    // Packed layout: upper triangle, one computed bit per entry, and
+    // two gather buffers (one column each).
+    bool packed_ = false;
+
+    mutable std::vector<Scalar> triangle_;
+    mutable std::vector<std::uint64_t> triangle_bits_;
+    mutable Matrix buffers_;
+    mutable std::array<std::size_t, 2> buffer_owner_{ npos, npos };
+    mutable std::size_t buffer_recent_ = 0;
+
+    // Bounded mode: row pool (one column per slot), diagonal, LRU state.
+    bool bounded_ = false;
+    std::size_t cache_bytes_ = 0;
+    std::size_t capacity_ = 0;
+
+    mutable Matrix rows_;
+    mutable std::vector<std::uint64_t> filled_;  // per-slot computed bits
+    std::size_t slot_words_ = 0;
+    Eigen::VectorXd diag_;
+    mutable std::vector<std::size_t> slot_;   // row -> slot or npos
+    mutable std::vector<std::size_t> owner_;  // slot -> row
+    mutable std::list<std::size_t> lru_;      // rows, most recent first
+    mutable std::vector<std::list<std::size_t>::iterator> lru_pos_;
 };
 
+/**
+ * Runtime-polymorphic kernel cache.
+ */
+using KernelCache = BasicKernelCache<KernelFunction>;
+
 } // namespace mlpp::classifiers::kernel
 
 #include "kernel_cache.inl"
\ No newline at end of file
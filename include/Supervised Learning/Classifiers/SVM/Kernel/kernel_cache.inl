@@ -1,33 +1,134 @@
 // include/Supervised Learning/Classifiers/SVM/Kernel/kernel_cache.inl
 #pragma once
 
+#include <algorithm>
+#include <ranges>
+#include <stdexcept>
+#include <utility>
+
 #include "kernel_cache.hpp"
+#include "Parallel/thread_pool.hpp"
 
 namespace mlpp::classifiers::kernel
 {
 
-inline KernelCache::KernelCache(const std::vector<Vector>& data,
-                                KernelFunction kernel)
+template <KernelEvaluator KernelT, std::floating_point Scalar>
+inline BasicKernelCache<KernelT, Scalar>::BasicKernelCache(const std::vector<Vector>& data,
+                                                           KernelT kernel)
+    : BasicKernelCache(data, std::move(kernel), CacheLayout::full)
+{
+}
+
+template <KernelEvaluator KernelT, std::floating_point Scalar>
+inline BasicKernelCache<KernelT, Scalar>::BasicKernelCache(const std::vector<Vector>& data,
+                                                           KernelT kernel,
+                                                           CacheLayout layout)
+    : data_(data),
+      kernel_(std::move(kernel)),
+      packed_(layout == CacheLayout::packed),
+      capacity_(data.size())
+{
+    const std::size_t n = data_.size();
+
+    if (packed_)
+    {
+        triangle_.resize(n * (n + 1) / 2);
+        triangle_bits_.assign(bit_words(triangle_.size()), 0);
+        buffers_.resize(n, 2);
+        return;
+    }
+
+    gram_.setZero(n, n);
+    computed_.setConstant(n, n, false);
+}
+
+template <KernelEvaluator KernelT, std::floating_point Scalar>
+inline BasicKernelCache<KernelT, Scalar>::BasicKernelCache(const std::vector<Vector>& data,
+                                                           KernelT kernel,
+                                                           std::size_t cache_bytes)
     : data_(data),
       kernel_(std::move(kernel)),
-      gram_(data.size(), data.size()),
-      computed_(data.size(), data.size())
+      bounded_(true),
+      cache_bytes_(cache_bytes),
+      capacity_(pool_capacity(data.size(), cache_bytes)),
+      slot_words_(bit_words(data.size())),
+      diag_(data.size()),
+      slot_(data.size(), npos),
+      lru_pos_(data.size())
+{
+    const std::size_t n = data_.size();
+
+    rows_.resize(n, capacity_);
+    filled_.assign(capacity_ * slot_words_, 0);
+    owner_.reserve(capacity_);
+
+    // The diagonal is touched by every SMO step; keep it resident.
+    for (std::size_t i = 0; i < n; ++i)
+        diag_(i) = kernel_(data_[i], data_[i]);
+}
+
+template <KernelEvaluator KernelT, std::floating_point Scalar>
+inline std::size_t
+BasicKernelCache<KernelT, Scalar>::bit_words(std::size_t bits) noexcept
+{
+    return (bits + 63) / 64;
+}
+
+template <KernelEvaluator KernelT, std::floating_point Scalar>
+inline std::size_t
+BasicKernelCache<KernelT, Scalar>::pool_capacity(std::size_t n,
+                                                 std::size_t cache_bytes) noexcept
+{
+    const std::size_t row_bytes = std::max<std::size_t>(
+        1, n * sizeof(Scalar) + bit_words(n) * sizeof(std::uint64_t));
+
+    return std::min(n, std::max<std::size_t>(2, cache_bytes / row_bytes));
+}
+
+template <KernelEvaluator KernelT, std::floating_point Scalar>
+inline std::size_t
+BasicKernelCache<KernelT, Scalar>::packed_index(std::size_t n,
+                                                std::size_t i,
+                                                std::size_t j) noexcept
 {
-    gram_.setZero();
-    computed_.setConstant(false);
+    // Rows 0 .. i−1 hold n, n − 1, ..., n − i + 1 entries.
+    return i * (2 * n - i + 1) / 2 + (j - i);
 }
 
+template <KernelEvaluator KernelT, std::floating_point Scalar>
 inline std::size_t
-KernelCache::size() const noexcept
+BasicKernelCache<KernelT, Scalar>::size() const noexcept
 {
     return data_.size();
 }
 
+template <KernelEvaluator KernelT, std::floating_point Scalar>
+inline bool
+BasicKernelCache<KernelT, Scalar>::bounded() const noexcept
+{
+    return bounded_;
+}
+
+template <KernelEvaluator KernelT, std::floating_point Scalar>
+inline bool
+BasicKernelCache<KernelT, Scalar>::packed() const noexcept
+{
+    return packed_;
+}
+
+template <KernelEvaluator KernelT, std::floating_point Scalar>
+inline std::size_t
+BasicKernelCache<KernelT, Scalar>::capacity() const noexcept
+{
+    return capacity_;
+}
+
+template <KernelEvaluator KernelT, std::floating_point Scalar>
 inline void
-KernelCache::compute_entry(std::size_t i,
-                           std::size_t j) const
+BasicKernelCache<KernelT, Scalar>::compute_entry(std::size_t i,
+                                                 std::size_t j) const
 {
-    const double value = kernel_(data_[i], data_[j]);
+    const auto value = static_cast<Scalar>(kernel_(data_[i], data_[j]));
 
     gram_(i, j) = value;
     gram_(j, i) = value;
@@ -36,42 +137,520 @@ KernelCache::compute_entry(std::size_t i,
     computed_(j, i) = true;
 }
 
+template <KernelEvaluator KernelT, std::floating_point Scalar>
+inline Scalar
+BasicKernelCache<KernelT, Scalar>::packed_entry(std::size_t i,
+                                                std::size_t j) const
+{
+    if (i > j)
+        std::swap(i, j);
+
+    const std::size_t k = packed_index(size(), i, j);
+    std::uint64_t& word = triangle_bits_[k / 64];
+    const std::uint64_t bit = std::uint64_t{ 1 } << (k % 64);
+
+    if (!complete_ && !(word & bit))
+    {
+        triangle_[k] = static_cast<Scalar>(kernel_(data_[i], data_[j]));
+        word |= bit;
+    }
+
+    return triangle_[k];
+}
+
+template <KernelEvaluator KernelT, std::floating_point Scalar>
+template <typename Columns>
+inline const Scalar*
+BasicKernelCache<KernelT, Scalar>::gather_row(std::size_t i,
+                                              const Columns& columns) const
+{
+    std::size_t b = 1 - buffer_recent_;
+
+    for (std::size_t c = 0; c < buffer_owner_.size(); ++c)
+    {
+        if (buffer_owner_[c] == i)
+            b = c;
+    }
+
+    Scalar* out = buffers_.col(static_cast<Eigen::Index>(b)).data();
+
+    for (std::size_t j : columns)
+        out[j] = packed_entry(i, j);
+
+    buffer_owner_[b] = i;
+    buffer_recent_ = b;
+
+    return out;
+}
+
+template <KernelEvaluator KernelT, std::floating_point Scalar>
+inline bool
+BasicKernelCache<KernelT, Scalar>::filled(std::size_t slot,
+                                          std::size_t j) const noexcept
+{
+    return (filled_[slot * slot_words_ + j / 64] >> (j % 64)) & 1u;
+}
+
+template <KernelEvaluator KernelT, std::floating_point Scalar>
+inline void
+BasicKernelCache<KernelT, Scalar>::set_filled(std::size_t slot,
+                                              std::size_t j) const noexcept
+{
+    filled_[slot * slot_words_ + j / 64] |= std::uint64_t{ 1 } << (j % 64);
+}
+
+template <KernelEvaluator KernelT, std::floating_point Scalar>
+inline std::size_t
+BasicKernelCache<KernelT, Scalar>::fetch_row(std::size_t i) const
+{
+    if (slot_[i] != npos)
+    {
+        lru_.splice(lru_.begin(), lru_, lru_pos_[i]);
+        return slot_[i];
+    }
+
+    std::size_t s;
+
+    if (owner_.size() < capacity_)
+    {
+        s = owner_.size();
+        owner_.push_back(i);
+    }
+    else
+    {
+        const std::size_t victim = lru_.back();
+        lru_.pop_back();
+
+        s = slot_[victim];
+        slot_[victim] = npos;
+        owner_[s] = i;
+    }
+
+    std::fill_n(filled_.begin() + static_cast<std::ptrdiff_t>(s * slot_words_),
+                slot_words_, std::uint64_t{ 0 });
+    rows_(i, s) = static_cast<Scalar>(diag_(i));
+    set_filled(s, i);
+
+    lru_.push_front(i);
+    lru_pos_[i] = lru_.begin();
+    slot_[i] = s;
+
+    return s;
+}
+
+template <KernelEvaluator KernelT, std::floating_point Scalar>
 inline double
-KernelCache::operator()(std::size_t i,
-                         std::size_t j) const
+BasicKernelCache<KernelT, Scalar>::operator()(std::size_t i,
+                                              std::size_t j) const
 {
-    if (!computed_(i, j))
+    if (bounded_)
+    {
+        if (i == j)
+            return diag_(i);
+        if (slot_[i] != npos && filled(slot_[i], j))
+            return rows_(j, slot_[i]);
+        if (slot_[j] != npos && filled(slot_[j], i))
+            return rows_(i, slot_[j]);
+
+        // Isolated entries are not worth a whole row.
+        return kernel_(data_[i], data_[j]);
+    }
+
+    if (packed_)
+        return packed_entry(i, j);
+
+    if (!complete_ && !computed_(i, j))
         compute_entry(i, j);
 
     return gram_(i, j);
 }
 
+template <KernelEvaluator KernelT, std::floating_point Scalar>
+inline const Scalar*
+BasicKernelCache<KernelT, Scalar>::row(std::size_t i) const
+{
+    const std::size_t n = size();
+
+    if (bounded_)
+    {
+        const std::size_t s = fetch_row(i);
+
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            if (!filled(s, j))
+            {
+                rows_(j, s) = static_cast<Scalar>(kernel_(data_[i], data_[j]));
+                set_filled(s, j);
+            }
+        }
+
+        return rows_.col(static_cast<Eigen::Index>(s)).data();
+    }
+
+    if (packed_)
+        return gather_row(i, std::views::iota(std::size_t{ 0 }, n));
+
+    // Column-major storage: column i of the symmetric matrix is row i.
+    if (!complete_)
+    {
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            if (!computed_(j, i))
+                compute_entry(j, i);
+        }
+    }
+
+    return gram_.col(static_cast<Eigen::Index>(i)).data();
+}
+
+template <KernelEvaluator KernelT, std::floating_point Scalar>
+inline const Scalar*
+BasicKernelCache<KernelT, Scalar>::row(std::size_t i,
+                                       const std::vector<std::size_t>& subset) const
+{
+    if (bounded_)
+    {
+        const std::size_t s = fetch_row(i);
+
+        for (std::size_t j : subset)
+        {
+            if (!filled(s, j))
+            {
+                rows_(j, s) = static_cast<Scalar>(kernel_(data_[i], data_[j]));
+                set_filled(s, j);
+            }
+        }
+
+        return rows_.col(static_cast<Eigen::Index>(s)).data();
+    }
+
+    if (packed_)
+        return gather_row(i, subset);
+
+    if (!complete_)
+    {
+        for (std::size_t j : subset)
+        {
+            if (!computed_(j, i))
+                compute_entry(j, i);
+        }
+    }
+
+    return gram_.col(static_cast<Eigen::Index>(i)).data();
+}
+
+template <KernelEvaluator KernelT, std::floating_point Scalar>
 inline void
-KernelCache::precompute() const
+BasicKernelCache<KernelT, Scalar>::precompute(std::size_t threads) const
 {
+    if (bounded_ || complete_)
+        return;
+
     const std::size_t n = size();
+    const std::size_t blocks = (n + precompute_tile - 1) / precompute_tile;
 
-    for (std::size_t i = 0; i < n; ++i)
+    // Upper-triangular block pairs (I, J), I ≤ J, in row-major order.
+    std::vector<std::pair<std::size_t, std::size_t>> tiles;
+    tiles.reserve(blocks * (blocks + 1) / 2);
+
+    for (std::size_t I = 0; I < blocks; ++I)
+        for (std::size_t J = I; J < blocks; ++J)
+            tiles.emplace_back(I, J);
+
+    parallel::ThreadPool pool(parallel::resolve_threads(threads) - 1);
+
+    if (packed_)
+    {
+        // Packed rows are contiguous in j; the bitmap is only read here.
+        pool.parallel_for(tiles.size(), [&](std::size_t t)
+        {
+            const auto [I, J] = tiles[t];
+
+            const std::size_t i0 = I * precompute_tile;
+            const std::size_t i1 = std::min(n, i0 + precompute_tile);
+            const std::size_t j0 = J * precompute_tile;
+            const std::size_t j1 = std::min(n, j0 + precompute_tile);
+
+            for (std::size_t i = i0; i < i1; ++i)
+            {
+                for (std::size_t j = std::max(j0, i); j < j1; ++j)
+                {
+                    const std::size_t k = packed_index(n, i, j);
+
+                    if (!((triangle_bits_[k / 64] >> (k % 64)) & 1u))
+                        triangle_[k] = static_cast<Scalar>(kernel_(data_[i], data_[j]));
+                }
+            }
+        });
+
+        std::fill(triangle_bits_.begin(), triangle_bits_.end(), ~std::uint64_t{ 0 });
+        complete_ = true;
+        return;
+    }
+
+    // Fill K_ij, i ≤ j, one column of a block at a time so that the
+    // stores into column-major storage stay contiguous.
+    pool.parallel_for(tiles.size(), [&](std::size_t t)
+    {
+        const auto [I, J] = tiles[t];
+
+        const std::size_t i0 = I * precompute_tile;
+        const std::size_t i1 = std::min(n, i0 + precompute_tile);
+        const std::size_t j0 = J * precompute_tile;
+        const std::size_t j1 = std::min(n, j0 + precompute_tile);
+
+        for (std::size_t j = j0; j < j1; ++j)
+        {
+            for (std::size_t i = i0; i < std::min(i1, j + 1); ++i)
+            {
+                if (!computed_(i, j))
+                    gram_(i, j) = static_cast<Scalar>(kernel_(data_[i], data_[j]));
+            }
+        }
+    });
+
+    // Mirror into the strictly lower triangle.
+    pool.parallel_for(tiles.size(), [&](std::size_t t)
     {
-        for (std::size_t j = i; j < n; ++j)
+        const auto [I, J] = tiles[t];
+
+        const std::size_t i0 = I * precompute_tile;
+        const std::size_t i1 = std::min(n, i0 + precompute_tile);
+        const std::size_t j0 = J * precompute_tile;
+        const std::size_t j1 = std::min(n, j0 + precompute_tile);
+
+        for (std::size_t i = i0; i < i1; ++i)
         {
-            if (!computed_(i, j))
-                compute_entry(i, j);
+            for (std::size_t j = std::max(j0, i + 1); j < j1; ++j)
+                gram_(j, i) = gram_(i, j);
         }
+    });
+
+    computed_.setConstant(true);
+    complete_ = true;
+}
+
+template <KernelEvaluator KernelT, std::floating_point Scalar>
+inline std::size_t
+BasicKernelCache<KernelT, Scalar>::cached_size() const noexcept
+{
+    if (bounded_)
+        return slot_.size();
+    if (packed_)
+        return static_cast<std::size_t>(buffers_.rows());
+
+    return static_cast<std::size_t>(gram_.rows());
+}
+
+template <KernelEvaluator KernelT, std::floating_point Scalar>
+inline void
+BasicKernelCache<KernelT, Scalar>::append(std::size_t count)
+{
+    const std::size_t old_n = cached_size();
+
+    if (old_n + count != size())
+        throw std::invalid_argument(
+            "KernelCache::append: count does not match the dataset");
+
+    std::vector<std::size_t> source(size(), npos);
+    for (std::size_t k = 0; k < old_n; ++k)
+        source[k] = k;
+
+    reindex(source);
+}
+
+template <KernelEvaluator KernelT, std::floating_point Scalar>
+inline void
+BasicKernelCache<KernelT, Scalar>::remove(const std::vector<std::size_t>& indices)
+{
+    const std::size_t old_n = cached_size();
+
+    std::vector<bool> erased(old_n, false);
+    std::size_t count = 0;
+
+    for (std::size_t i : indices)
+    {
+        if (i >= old_n)
+            throw std::out_of_range("KernelCache::remove: index out of range");
+        if (!erased[i])
+            ++count;
+        erased[i] = true;
     }
+
+    if (old_n - count != size())
+        throw std::invalid_argument(
+            "KernelCache::remove: indices do not match the dataset");
+
+    std::vector<std::size_t> source;
+    source.reserve(size());
+
+    for (std::size_t i = 0; i < old_n; ++i)
+    {
+        if (!erased[i])
+            source.push_back(i);
+    }
+
+    reindex(source);
 }
 
-inline const KernelCache::Matrix&
-KernelCache::gram_matrix() const
+template <KernelEvaluator KernelT, std::floating_point Scalar>
+inline void
+BasicKernelCache<KernelT, Scalar>::reindex(const std::vector<std::size_t>& source)
 {
+    const std::size_t n = source.size();
+    const auto m = static_cast<Eigen::Index>(n);
+
+    const bool grows = std::ranges::find(source, npos) != source.end();
+
+    if (packed_)
+    {
+        const std::size_t old_n = cached_size();
+
+        std::vector<Scalar> triangle(n * (n + 1) / 2);
+        std::vector<std::uint64_t> bits(bit_words(triangle.size()), 0);
+
+        for (std::size_t a = 0; a < n; ++a)
+        {
+            for (std::size_t b = a; b < n; ++b)
+            {
+                if (source[a] == npos || source[b] == npos)
+                    continue;
+
+                const std::size_t lo = std::min(source[a], source[b]);
+                const std::size_t hi = std::max(source[a], source[b]);
+                const std::size_t from = packed_index(old_n, lo, hi);
+
+                if (!((triangle_bits_[from / 64] >> (from % 64)) & 1u))
+                    continue;
+
+                const std::size_t to = packed_index(n, a, b);
+                triangle[to] = triangle_[from];
+                bits[to / 64] |= std::uint64_t{ 1 } << (to % 64);
+            }
+        }
+
+        triangle_ = std::move(triangle);
+        triangle_bits_ = std::move(bits);
+        complete_ = complete_ && !grows;
+        capacity_ = n;
+
+        buffers_.resize(m, 2);
+        buffer_owner_ = { npos, npos };
+        return;
+    }
+
+    if (!bounded_)
+    {
+        Matrix gram = Matrix::Zero(m, m);
+        Eigen::ArrayXX<bool> computed = Eigen::ArrayXX<bool>::Constant(m, m, false);
+
+        for (std::size_t b = 0; b < n; ++b)
+        {
+            if (source[b] == npos)
+                continue;
+
+            for (std::size_t a = 0; a < n; ++a)
+            {
+                if (source[a] == npos || !computed_(source[a], source[b]))
+                    continue;
+
+                gram(a, b) = gram_(source[a], source[b]);
+                computed(a, b) = true;
+            }
+        }
+
+        gram_ = std::move(gram);
+        computed_ = std::move(computed);
+        complete_ = complete_ && !grows;
+        capacity_ = n;
+        return;
+    }
+
+    // Bounded mode: the budget now buys rows of a different length, so
+    // keep the most recently used rows that still fit and repack them
+    // into the first slots.
+    const std::size_t capacity = pool_capacity(n, cache_bytes_);
+    const std::size_t words = bit_words(n);
+
+    std::vector<std::size_t> target(slot_.size(), npos);
+    for (std::size_t k = 0; k < n; ++k)
+    {
+        if (source[k] != npos)
+            target[source[k]] = k;
+    }
+
+    Matrix rows(m, static_cast<Eigen::Index>(capacity));
+    std::vector<std::uint64_t> filled(capacity * words, 0);
+    Eigen::VectorXd diag(m);
+
+    std::vector<std::size_t> owner;
+    owner.reserve(capacity);
+    std::list<std::size_t> lru;
+
+    for (std::size_t r : lru_)
+    {
+        if (target[r] == npos || owner.size() == capacity)
+            continue;
+
+        const std::size_t from = slot_[r];
+        const std::size_t to = owner.size();
+
+        for (std::size_t a = 0; a < n; ++a)
+        {
+            if (source[a] == npos || !this->filled(from, source[a]))
+                continue;
+
+            rows(a, to) = rows_(source[a], from);
+            filled[to * words + a / 64] |= std::uint64_t{ 1 } << (a % 64);
+        }
+
+        owner.push_back(target[r]);
+        lru.push_back(target[r]);
+    }
+
+    for (std::size_t k = 0; k < n; ++k)
+    {
+        diag(k) = source[k] != npos ? diag_(source[k])
+                                    : kernel_(data_[k], data_[k]);
+    }
+
+    rows_ = std::move(rows);
+    filled_ = std::move(filled);
+    slot_words_ = words;
+    diag_ = std::move(diag);
+    owner_ = std::move(owner);
+    lru_ = std::move(lru);
+    capacity_ = capacity;
+
+    slot_.assign(n, npos);
+    lru_pos_.assign(n, {});
+
+    for (std::size_t s = 0; s < owner_.size(); ++s)
+        slot_[owner_[s]] = s;
+    for (auto it = lru_.begin(); it != lru_.end(); ++it)
+        lru_pos_[*it] = it;
+}
+
+template <KernelEvaluator KernelT, std::floating_point Scalar>
+inline const typename BasicKernelCache<KernelT, Scalar>::Matrix&
+BasicKernelCache<KernelT, Scalar>::gram_matrix() const
+{
+    if (bounded_)
+        throw std::logic_error(
+            "KernelCache::gram_matrix: not available in bounded mode");
+    if (packed_)
+        throw std::logic_error(
+            "KernelCache::gram_matrix: not available in packed mode");
+
     precompute();
     return gram_;
 }
 
-inline const KernelFunction&
-KernelCache::kernel() const noexcept
+template <KernelEvaluator KernelT, std::floating_point Scalar>
+inline const KernelT&
+BasicKernelCache<KernelT, Scalar>::kernel() const noexcept
 {
     return kernel_;
 }
 
-} // namespace mlpp::classifiers::kernel
\ No newline at end of file
+} // namespace mlpp::classifiers::kernel
@@ -29,6 +29,11 @@ public:
     double operator()(const Vector& x,
                       const Vector& y) const noexcept override;
 
+    [[nodiscard]]
+    double evaluate(const double* x,
+                    const double* y,
+                    std::size_t dim) const override;
+
     [[nodiscard]]
     std::unique_ptr<Kernel> clone() const override;
 
@@ -55,6 +60,11 @@ public:
     double operator()(const Vector& x,
                       const Vector& y) const noexcept override;
 
+    [[nodiscard]]
+    double evaluate(const double* x,
+                    const double* y,
+                    std::size_t dim) const override;
+
     [[nodiscard]]
     std::unique_ptr<Kernel> clone() const override;
 
@@ -80,6 +90,11 @@ public:
     double operator()(const Vector& x,
                       const Vector& y) const noexcept override;
 
+    [[nodiscard]]
+    double evaluate(const double* x,
+                    const double* y,
+                    std::size_t dim) const override;
+
     [[nodiscard]]
     std::unique_ptr<Kernel> clone() const override;
 
@@ -107,6 +122,11 @@ public:
     double operator()(const Vector& x,
                       const Vector& y) const noexcept override;
 
+    [[nodiscard]]
+    double evaluate(const double* x,
+                    const double* y,
+                    std::size_t dim) const override;
+
     [[nodiscard]]
     std::unique_ptr<Kernel> clone() const override;
 
@@ -114,4 +134,6 @@ private:
     KernelFunction base_;
 };
 
-} // namespace mlpp::classifiers::kernel
\ No newline at end of file
+} // namespace mlpp::classifiers::kernel
+
+#include "kernel_composition.inl"
\ No newline at end of file
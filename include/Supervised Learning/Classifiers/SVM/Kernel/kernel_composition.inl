@@ -20,6 +20,14 @@ SumKernel::operator()(const Vector& x,
     return k1_(x, y) + k2_(x, y);
 }
 
+inline double
+SumKernel::evaluate(const double* x,
+                    const double* y,
+                    std::size_t dim) const
+{
+    return k1_.evaluate(x, y, dim) + k2_.evaluate(x, y, dim);
+}
+
 inline std::unique_ptr<Kernel>
 SumKernel::clone() const
 {
@@ -39,6 +47,14 @@ ProductKernel::operator()(const Vector& x,
     return k1_(x, y) * k2_(x, y);
 }
 
+inline double
+ProductKernel::evaluate(const double* x,
+                        const double* y,
+                        std::size_t dim) const
+{
+    return k1_.evaluate(x, y, dim) * k2_.evaluate(x, y, dim);
+}
+
 inline std::unique_ptr<Kernel>
 ProductKernel::clone() const
 {
@@ -58,6 +74,14 @@ ScaledKernel::operator()(const Vector& x,
     return scale_ * kernel_(x, y);
 }
 
+inline double
+ScaledKernel::evaluate(const double* x,
+                       const double* y,
+                       std::size_t dim) const
+{
+    return scale_ * kernel_.evaluate(x, y, dim);
+}
+
 inline std::unique_ptr<Kernel>
 ScaledKernel::clone() const
 {
@@ -75,6 +99,14 @@ ExponentialKernel::operator()(const Vector& x,
     return std::exp(base_(x, y));
 }
 
+inline double
+ExponentialKernel::evaluate(const double* x,
+                            const double* y,
+                            std::size_t dim) const
+{
+    return std::exp(base_.evaluate(x, y, dim));
+}
+
 inline std::unique_ptr<Kernel>
 ExponentialKernel::clone() const
 {
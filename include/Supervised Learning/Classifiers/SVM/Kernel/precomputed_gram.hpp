@@ -0,0 +1,50 @@
+// include/Supervised Learning/Classifiers/SVM/Kernel/precomputed_gram.hpp
+#pragma once
+
+#include <Eigen/Dense>
+#include <vector>
+#include <cstddef>
+
+namespace mlpp::classifiers::kernel
+{
+
+/**
+ * @brief Gram matrix supplied as an explicit symmetric matrix.
+ *
+ * Gives SMOSolver and SubsetGram access to a kernel matrix that was
+ * built outside a kernel cache, e.g. one exp(−γ D) per γ from a
+ * shared squared-distance matrix D. The view never writes, so it may
+ * be read from any number of threads.
+ */
+class PrecomputedGram
+{
+public:
+    /**
+     * @param gram  Symmetric n × n kernel matrix; must outlive the view
+     */
+    explicit PrecomputedGram(const Eigen::MatrixXd& gram) noexcept;
+
+    [[nodiscard]]
+    std::size_t size() const noexcept;
+
+    [[nodiscard]]
+    double operator()(std::size_t i,
+                      std::size_t j) const noexcept;
+
+    /**
+     * @brief Row i, read in place from column i.
+     */
+    [[nodiscard]]
+    const double* row(std::size_t i) const noexcept;
+
+    [[nodiscard]]
+    const double* row(std::size_t i,
+                      const std::vector<std::size_t>& subset) const noexcept;
+
+private:
+    const Eigen::MatrixXd& gram_;
+};
+
+} // namespace mlpp::classifiers::kernel
+
+#include "precomputed_gram.inl"
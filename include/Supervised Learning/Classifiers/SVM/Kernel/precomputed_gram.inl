@@ -0,0 +1,40 @@
+// include/Supervised Learning/Classifiers/SVM/Kernel/precomputed_gram.inl
+#pragma once
+
+#include "precomputed_gram.hpp"
+
+namespace mlpp::classifiers::kernel
+{
+
+inline PrecomputedGram::PrecomputedGram(const Eigen::MatrixXd& gram) noexcept
+    : gram_(gram)
+{
+}
+
+inline std::size_t
+PrecomputedGram::size() const noexcept
+{
+    return static_cast<std::size_t>(gram_.rows());
+}
+
+inline double
+PrecomputedGram::operator()(std::size_t i,
+                            std::size_t j) const noexcept
+{
+    return gram_(static_cast<Eigen::Index>(i), static_cast<Eigen::Index>(j));
+}
+
+inline const double*
+PrecomputedGram::row(std::size_t i) const noexcept
+{
+    return gram_.col(static_cast<Eigen::Index>(i)).data();
+}
+
+inline const double*
+PrecomputedGram::row(std::size_t i,
+                     const std::vector<std::size_t>&) const noexcept
+{
+    return row(i);
+}
+
+} // namespace mlpp::classifiers::kernel
@@ -22,6 +22,11 @@ public:
     double operator()(const Vector& x,
                       const Vector& y) const noexcept override;
 
+    [[nodiscard]]
+    double evaluate(const double* x,
+                    const double* y,
+                    std::size_t dim) const noexcept override;
+
     [[nodiscard]]
     std::unique_ptr<Kernel> clone() const override;
 };
@@ -45,9 +50,23 @@ public:
     double operator()(const Vector& x,
                       const Vector& y) const noexcept override;
 
+    [[nodiscard]]
+    double evaluate(const double* x,
+                    const double* y,
+                    std::size_t dim) const noexcept override;
+
     [[nodiscard]]
     std::unique_ptr<Kernel> clone() const override;
 
+    [[nodiscard]]
+    double gamma() const noexcept;
+
+    [[nodiscard]]
+    double coef0() const noexcept;
+
+    [[nodiscard]]
+    std::size_t degree() const noexcept;
+
 private:
     double gamma_;
     double coef0_;
@@ -71,9 +90,17 @@ public:
     double operator()(const Vector& x,
                       const Vector& y) const noexcept override;
 
+    [[nodiscard]]
+    double evaluate(const double* x,
+                    const double* y,
+                    std::size_t dim) const noexcept override;
+
     [[nodiscard]]
     std::unique_ptr<Kernel> clone() const override;
 
+    [[nodiscard]]
+    double gamma() const noexcept;
+
 private:
     double gamma_;
 };
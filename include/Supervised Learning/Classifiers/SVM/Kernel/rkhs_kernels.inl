@@ -1,10 +1,10 @@
 // include/Supervised Learning/Classifiers/SVM/Kernel/rkhs_kernels.inl
 #pragma once
 
-#include <numeric>
 #include <cmath>
 
 #include "rkhs_kernels.hpp"
+#include "simd_kernels.hpp"
 
 namespace mlpp::classifiers::kernel
 {
@@ -13,7 +13,15 @@ inline double
 LinearKernel::operator()(const Vector& x,
                          const Vector& y) const noexcept
 {
-    return std::inner_product(x.begin(), x.end(), y.begin(), 0.0);
+    return evaluate(x.data(), y.data(), x.size());
+}
+
+inline double
+LinearKernel::evaluate(const double* x,
+                       const double* y,
+                       std::size_t dim) const noexcept
+{
+    return simd::dot(x, y, dim);
 }
 
 inline std::unique_ptr<Kernel>
@@ -34,13 +42,15 @@ inline double
 PolynomialKernel::operator()(const Vector& x,
                              const Vector& y) const noexcept
 {
-    const double dot =
-        std::inner_product(x.begin(), x.end(), y.begin(), 0.0);
+    return evaluate(x.data(), y.data(), x.size());
+}
 
-    return std::pow(
-        gamma_ * dot + coef0_,
-        static_cast<double>(degree_)
-    );
+inline double
+PolynomialKernel::evaluate(const double* x,
+                           const double* y,
+                           std::size_t dim) const noexcept
+{
+    return simd::ipow(gamma_ * simd::dot(x, y, dim) + coef0_, degree_);
 }
 
 inline std::unique_ptr<Kernel>
@@ -49,6 +59,24 @@ PolynomialKernel::clone() const
     return std::make_unique<PolynomialKernel>(*this);
 }
 
+inline double
+PolynomialKernel::gamma() const noexcept
+{
+    return gamma_;
+}
+
+inline double
+PolynomialKernel::coef0() const noexcept
+{
+    return coef0_;
+}
+
+inline std::size_t
+PolynomialKernel::degree() const noexcept
+{
+    return degree_;
+}
+
 inline RBFKernel::RBFKernel(double gamma) noexcept
     : gamma_(gamma)
 {}
@@ -57,15 +85,15 @@ inline double
 RBFKernel::operator()(const Vector& x,
                       const Vector& y) const noexcept
 {
-    double squared_distance = 0.0;
-
-    for (std::size_t i = 0; i < x.size(); ++i)
-    {
-        const double diff = x[i] - y[i];
-        squared_distance += diff * diff;
-    }
+    return evaluate(x.data(), y.data(), x.size());
+}
 
-    return std::exp(-gamma_ * squared_distance);
+inline double
+RBFKernel::evaluate(const double* x,
+                    const double* y,
+                    std::size_t dim) const noexcept
+{
+    return std::exp(-gamma_ * simd::squared_distance(x, y, dim));
 }
 
 inline std::unique_ptr<Kernel>
@@ -74,4 +102,10 @@ RBFKernel::clone() const
     return std::make_unique<RBFKernel>(*this);
 }
 
+inline double
+RBFKernel::gamma() const noexcept
+{
+    return gamma_;
+}
+
 } // namespace mlpp::classifiers::kernel
\ No newline at end of file
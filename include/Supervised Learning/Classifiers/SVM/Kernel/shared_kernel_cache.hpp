@@ -0,0 +1,132 @@
+// include/Supervised Learning/Classifiers/SVM/Kernel/shared_kernel_cache.hpp
+#pragma once
+
+#include "kernel.hpp"
+
+#include <Eigen/Dense>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <cstddef>
+
+namespace mlpp::classifiers::kernel
+{
+
+/**
+ * @brief Kernel (Gram) matrix cache that may be shared between threads.
+ *
+ * @tparam KernelT  Kernel evaluator, see BasicKernelCache.
+ *
+ * BasicKernelCache fills entries lazily through const accessors, so
+ * two threads reading it before precompute() race on the storage.
+ * This variant publishes whole rows instead:
+ *
+ *  - Every row carries an atomic ready flag. A reader that sees it set
+ *    (acquire) uses the row without taking any lock.
+ *  - A missing row is computed under one of row_stripes mutexes,
+ *    selected by the row index, so different rows fill in parallel
+ *    and a row is never computed twice.
+ *  - Entries K_ij with j in an already published row j are copied
+ *    from there instead of being evaluated again.
+ *
+ * A published row is never written again, so pointers returned by
+ * row() stay valid for the lifetime of the cache. Any number of
+ * solvers (CV folds through SubsetGram, grid points with the same
+ * kernel, one-vs-one machines) can therefore draw on one cache from a
+ * thread pool. Storage is the dense n × n matrix.
+ */
+template <KernelEvaluator KernelT>
+class BasicSharedKernelCache
+{
+public:
+    using Matrix = Eigen::MatrixXd;
+
+    /**
+     * @brief Construct a shared cache for a dataset and kernel.
+     *
+     * @param data    Input samples
+     * @param kernel  Kernel function
+     */
+    BasicSharedKernelCache(const std::vector<Vector>& data,
+                           KernelT kernel);
+
+    BasicSharedKernelCache(const BasicSharedKernelCache&) = delete;
+    BasicSharedKernelCache& operator=(const BasicSharedKernelCache&) = delete;
+
+    /**
+     * @brief Return the number of samples.
+     */
+    [[nodiscard]]
+    std::size_t size() const noexcept;
+
+    /**
+     * @brief Access a single Gram matrix entry.
+     *
+     * Read from a published row i or j if there is one, otherwise
+     * evaluated directly without being stored.
+     */
+    [[nodiscard]]
+    double operator()(std::size_t i,
+                      std::size_t j) const;
+
+    /**
+     * @brief Access a full Gram matrix row, publishing it if needed.
+     */
+    [[nodiscard]]
+    const double* row(std::size_t i) const;
+
+    /**
+     * @brief Same as row(i); rows are only published whole.
+     */
+    [[nodiscard]]
+    const double* row(std::size_t i,
+                      const std::vector<std::size_t>& subset) const;
+
+    /**
+     * @brief Whether row i has been published.
+     */
+    [[nodiscard]]
+    bool ready(std::size_t i) const noexcept;
+
+    /**
+     * @brief Publish every row, in parallel.
+     *
+     * @param threads  Number of threads (0 = all hardware threads)
+     */
+    void precompute(std::size_t threads = 0) const;
+
+    /**
+     * @brief Access the underlying kernel function.
+     */
+    [[nodiscard]]
+    const KernelT& kernel() const noexcept;
+
+private:
+    /**
+     * @brief Compute row i into its storage column and publish it.
+     *
+     * Caller holds the stripe mutex of row i.
+     */
+    void fill_row(std::size_t i) const;
+
+private:
+    static constexpr std::size_t row_stripes = 64;
+
+    const std::vector<Vector>& data_;
+    KernelT kernel_;
+
+    mutable Matrix gram_;   // column i holds row i once published
+    std::unique_ptr<std::atomic<bool>[]> ready_;
+    mutable std::array<std::mutex, row_stripes> stripes_;
+};
+
+/**
+ * Runtime-polymorphic shared kernel cache.
+ */
+using SharedKernelCache = BasicSharedKernelCache<KernelFunction>;
+
+} // namespace mlpp::classifiers::kernel
+
+#include "shared_kernel_cache.inl"
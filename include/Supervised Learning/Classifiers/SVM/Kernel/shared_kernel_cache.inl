@@ -0,0 +1,112 @@
+// include/Supervised Learning/Classifiers/SVM/Kernel/shared_kernel_cache.inl
+#pragma once
+
+#include <utility>
+
+#include "shared_kernel_cache.hpp"
+#include "Parallel/thread_pool.hpp"
+
+namespace mlpp::classifiers::kernel
+{
+
+template <KernelEvaluator KernelT>
+inline
+BasicSharedKernelCache<KernelT>::BasicSharedKernelCache(const std::vector<Vector>& data,
+                                                        KernelT kernel)
+    : data_(data),
+      kernel_(std::move(kernel)),
+      gram_(data.size(), data.size()),
+      ready_(std::make_unique<std::atomic<bool>[]>(data.size()))
+{
+    for (std::size_t i = 0; i < data_.size(); ++i)
+        ready_[i].store(false, std::memory_order_relaxed);
+}
+
+template <KernelEvaluator KernelT>
+inline std::size_t
+BasicSharedKernelCache<KernelT>::size() const noexcept
+{
+    return data_.size();
+}
+
+template <KernelEvaluator KernelT>
+inline bool
+BasicSharedKernelCache<KernelT>::ready(std::size_t i) const noexcept
+{
+    return ready_[i].load(std::memory_order_acquire);
+}
+
+template <KernelEvaluator KernelT>
+inline void
+BasicSharedKernelCache<KernelT>::fill_row(std::size_t i) const
+{
+    const std::size_t n = size();
+    double* out = gram_.col(static_cast<Eigen::Index>(i)).data();
+
+    for (std::size_t j = 0; j < n; ++j)
+    {
+        // Published rows are immutable; take the mirrored entry.
+        out[j] = ready(j) ? gram_(static_cast<Eigen::Index>(i),
+                                  static_cast<Eigen::Index>(j))
+                          : kernel_(data_[i], data_[j]);
+    }
+
+    ready_[i].store(true, std::memory_order_release);
+}
+
+template <KernelEvaluator KernelT>
+inline double
+BasicSharedKernelCache<KernelT>::operator()(std::size_t i,
+                                            std::size_t j) const
+{
+    if (ready(i))
+        return gram_(static_cast<Eigen::Index>(j), static_cast<Eigen::Index>(i));
+    if (ready(j))
+        return gram_(static_cast<Eigen::Index>(i), static_cast<Eigen::Index>(j));
+
+    return kernel_(data_[i], data_[j]);
+}
+
+template <KernelEvaluator KernelT>
+inline const double*
+BasicSharedKernelCache<KernelT>::row(std::size_t i) const
+{
+    if (!ready(i))
+    {
+        const std::lock_guard lock(stripes_[i % row_stripes]);
+
+        if (!ready(i))
+            fill_row(i);
+    }
+
+    return gram_.col(static_cast<Eigen::Index>(i)).data();
+}
+
+template <KernelEvaluator KernelT>
+inline const double*
+BasicSharedKernelCache<KernelT>::row(std::size_t i,
+                                     const std::vector<std::size_t>&) const
+{
+    return row(i);
+}
+
+template <KernelEvaluator KernelT>
+inline void
+BasicSharedKernelCache<KernelT>::precompute(std::size_t threads) const
+{
+    parallel::ThreadPool pool(parallel::resolve_threads(threads) - 1);
+
+    pool.parallel_for(size(), [&](std::size_t i)
+    {
+        [[maybe_unused]] const double* r = row(i);
+    });
+}
+
+template <KernelEvaluator KernelT>
+inline const KernelT&
+BasicSharedKernelCache<KernelT>::kernel() const noexcept
+{
+    return kernel_;
+}
+
+} // namespace mlpp::classifiers::kernel
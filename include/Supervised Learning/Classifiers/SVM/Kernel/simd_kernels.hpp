@@ -0,0 +1,70 @@
+// include/Supervised Learning/Classifiers/SVM/Kernel/simd_kernels.hpp
+#pragma once
+
+#include <cstddef>
+
+/**
+ * Vectorised primitives behind the dot-product kernels.
+ *
+ * The instruction set is chosen at compile time: AVX-512F if
+ * __AVX512F__ is defined, AVX2 + FMA if __AVX2__ and __FMA__ are,
+ * and a portable scalar loop with four independent accumulators
+ * otherwise. Build with MLPP_NATIVE_ARCH=ON (or -march=...) to enable
+ * the wide paths.
+ *
+ * Summation order differs between paths, so results may differ in the
+ * last bits across instruction sets, but are deterministic for a
+ * given build.
+ */
+namespace mlpp::classifiers::kernel::simd
+{
+
+/**
+ * <x, y> over dim contiguous values.
+ */
+[[nodiscard]]
+double dot(const double* x,
+           const double* y,
+           std::size_t dim) noexcept;
+
+/**
+ * ||x − y||² over dim contiguous values.
+ */
+[[nodiscard]]
+double squared_distance(const double* x,
+                        const double* y,
+                        std::size_t dim) noexcept;
+
+/**
+ * out[r] = <q, rows_r> for count rows stored row-major with stride dim.
+ *
+ * Rows are processed four at a time so each chunk of q is loaded
+ * once per block.
+ */
+void dot_many(const double* q,
+              const double* rows,
+              std::size_t count,
+              std::size_t dim,
+              double* out) noexcept;
+
+/**
+ * out[r] = ||q − rows_r||² for count rows stored row-major with
+ * stride dim.
+ */
+void squared_distance_many(const double* q,
+                           const double* rows,
+                           std::size_t count,
+                           std::size_t dim,
+                           double* out) noexcept;
+
+/**
+ * base^exp by repeated squaring: O(log exp) multiplications and
+ * exact for small integral results, unlike std::pow.
+ */
+[[nodiscard]]
+constexpr double ipow(double base,
+                      std::size_t exp) noexcept;
+
+} // namespace mlpp::classifiers::kernel::simd
+
+#include "simd_kernels.inl"
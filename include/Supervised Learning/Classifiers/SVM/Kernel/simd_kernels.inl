@@ -0,0 +1,246 @@
+// include/Supervised Learning/Classifiers/SVM/Kernel/simd_kernels.inl
+#pragma once
+
+#if defined(__AVX512F__) || (defined(__AVX2__) && defined(__FMA__))
+#include <immintrin.h>
+#endif
+
+#include "simd_kernels.hpp"
+
+namespace mlpp::classifiers::kernel::simd
+{
+
+namespace detail
+{
+
+#if defined(__AVX512F__)
+
+struct Lane
+{
+    using Reg = __m512d;
+    static constexpr std::size_t width = 8;
+
+    static Reg zero() noexcept { return _mm512_setzero_pd(); }
+    static Reg load(const double* p) noexcept { return _mm512_loadu_pd(p); }
+    static Reg add(Reg a, Reg b) noexcept { return _mm512_add_pd(a, b); }
+    static Reg sub(Reg a, Reg b) noexcept { return _mm512_sub_pd(a, b); }
+    static Reg fmadd(Reg a, Reg b, Reg c) noexcept { return _mm512_fmadd_pd(a, b, c); }
+    static double sum(Reg a) noexcept { return _mm512_reduce_add_pd(a); }
+};
+
+#elif defined(__AVX2__) && defined(__FMA__)
+
+struct Lane
+{
+    using Reg = __m256d;
+    static constexpr std::size_t width = 4;
+
+    static Reg zero() noexcept { return _mm256_setzero_pd(); }
+    static Reg load(const double* p) noexcept { return _mm256_loadu_pd(p); }
+    static Reg add(Reg a, Reg b) noexcept { return _mm256_add_pd(a, b); }
+    static Reg sub(Reg a, Reg b) noexcept { return _mm256_sub_pd(a, b); }
+    static Reg fmadd(Reg a, Reg b, Reg c) noexcept { return _mm256_fmadd_pd(a, b, c); }
+
+    static double sum(Reg a) noexcept
+    {
+        const __m128d lo = _mm256_castpd256_pd128(a);
+        const __m128d hi = _mm256_extractf128_pd(a, 1);
+        const __m128d s = _mm_add_pd(lo, hi);
+        return _mm_cvtsd_f64(_mm_add_sd(s, _mm_unpackhi_pd(s, s)));
+    }
+};
+
+#else
+
+struct Lane
+{
+    using Reg = double;
+    static constexpr std::size_t width = 1;
+
+    static Reg zero() noexcept { return 0.0; }
+    static Reg load(const double* p) noexcept { return *p; }
+    static Reg add(Reg a, Reg b) noexcept { return a + b; }
+    static Reg sub(Reg a, Reg b) noexcept { return a - b; }
+    static Reg fmadd(Reg a, Reg b, Reg c) noexcept { return a * b + c; }
+    static double sum(Reg a) noexcept { return a; }
+};
+
+#endif
+
+// acc += x·y  (dot)   or   acc += (x − y)²  (squared distance)
+template <bool Distance>
+inline Lane::Reg
+step(Lane::Reg x, Lane::Reg y, Lane::Reg acc) noexcept
+{
+    if constexpr (Distance)
+    {
+        const Lane::Reg d = Lane::sub(x, y);
+        return Lane::fmadd(d, d, acc);
+    }
+    else
+    {
+        return Lane::fmadd(x, y, acc);
+    }
+}
+
+template <bool Distance>
+inline double
+step_scalar(double x, double y, double acc) noexcept
+{
+    if constexpr (Distance)
+        return (x - y) * (x - y) + acc;
+    else
+        return x * y + acc;
+}
+
+template <bool Distance>
+inline double
+reduce(const double* x,
+       const double* y,
+       std::size_t dim) noexcept
+{
+    constexpr std::size_t W = Lane::width;
+
+    Lane::Reg a0 = Lane::zero();
+    Lane::Reg a1 = Lane::zero();
+    Lane::Reg a2 = Lane::zero();
+    Lane::Reg a3 = Lane::zero();
+
+    std::size_t i = 0;
+
+    // Four independent accumulators hide the FMA latency.
+    for (; i + 4 * W <= dim; i += 4 * W)
+    {
+        a0 = step<Distance>(Lane::load(x + i),         Lane::load(y + i),         a0);
+        a1 = step<Distance>(Lane::load(x + i + W),     Lane::load(y + i + W),     a1);
+        a2 = step<Distance>(Lane::load(x + i + 2 * W), Lane::load(y + i + 2 * W), a2);
+        a3 = step<Distance>(Lane::load(x + i + 3 * W), Lane::load(y + i + 3 * W), a3);
+    }
+
+    for (; i + W <= dim; i += W)
+        a0 = step<Distance>(Lane::load(x + i), Lane::load(y + i), a0);
+
+    double s = Lane::sum(Lane::add(Lane::add(a0, a1), Lane::add(a2, a3)));
+
+    for (; i < dim; ++i)
+        s = step_scalar<Distance>(x[i], y[i], s);
+
+    return s;
+}
+
+template <bool Distance>
+inline void
+reduce_many(const double* q,
+            const double* rows,
+            std::size_t count,
+            std::size_t dim,
+            double* out) noexcept
+{
+    constexpr std::size_t W = Lane::width;
+
+    std::size_t r = 0;
+
+    for (; r + 4 <= count; r += 4)
+    {
+        const double* r0 = rows + r * dim;
+        const double* r1 = r0 + dim;
+        const double* r2 = r1 + dim;
+        const double* r3 = r2 + dim;
+
+        Lane::Reg a0 = Lane::zero();
+        Lane::Reg a1 = Lane::zero();
+        Lane::Reg a2 = Lane::zero();
+        Lane::Reg a3 = Lane::zero();
+
+        std::size_t i = 0;
+
+        for (; i + W <= dim; i += W)
+        {
+            const Lane::Reg qv = Lane::load(q + i);
+
+            a0 = step<Distance>(qv, Lane::load(r0 + i), a0);
+            a1 = step<Distance>(qv, Lane::load(r1 + i), a1);
+            a2 = step<Distance>(qv, Lane::load(r2 + i), a2);
+            a3 = step<Distance>(qv, Lane::load(r3 + i), a3);
+        }
+
+        double s0 = Lane::sum(a0);
+        double s1 = Lane::sum(a1);
+        double s2 = Lane::sum(a2);
+        double s3 = Lane::sum(a3);
+
+        for (; i < dim; ++i)
+        {
+            s0 = step_scalar<Distance>(q[i], r0[i], s0);
+            s1 = step_scalar<Distance>(q[i], r1[i], s1);
+            s2 = step_scalar<Distance>(q[i], r2[i], s2);
+            s3 = step_scalar<Distance>(q[i], r3[i], s3);
+        }
+
+        out[r]     = s0;
+        out[r + 1] = s1;
+        out[r + 2] = s2;
+        out[r + 3] = s3;
+    }
+
+    for (; r < count; ++r)
+        out[r] = reduce<Distance>(q, rows + r * dim, dim);
+}
+
+} // namespace detail
+
+inline double
+dot(const double* x,
+    const double* y,
+    std::size_t dim) noexcept
+{
+    return detail::reduce<false>(x, y, dim);
+}
+
+inline double
+squared_distance(const double* x,
+                 const double* y,
+                 std::size_t dim) noexcept
+{
+    return detail::reduce<true>(x, y, dim);
+}
+
+inline void
+dot_many(const double* q,
+         const double* rows,
+         std::size_t count,
+         std::size_t dim,
+         double* out) noexcept
+{
+    detail::reduce_many<false>(q, rows, count, dim, out);
+}
+
+inline void
+squared_distance_many(const double* q,
+                      const double* rows,
+                      std::size_t count,
+                      std::size_t dim,
+                      double* out) noexcept
+{
+    detail::reduce_many<true>(q, rows, count, dim, out);
+}
+
+constexpr double
+ipow(double base,
+     std::size_t exp) noexcept
+{
+    double result = 1.0;
+
+    while (exp > 0)
+    {
+        if (exp & 1u)
+            result *= base;
+
+        base *= base;
+        exp >>= 1u;
+    }
+
+    return result;
+}
+
+} // namespace mlpp::classifiers::kernel::simd
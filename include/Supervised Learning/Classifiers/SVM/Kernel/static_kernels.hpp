@@ -0,0 +1,163 @@
+// include/Supervised Learning/Classifiers/SVM/Kernel/static_kernels.hpp
+#pragma once
+#include "kernel.hpp"
+
+#include <cstddef>
+#include <memory>
+
+/**
+ * Compile-time kernels
+ *
+ * Value types with non-virtual evaluation, meant as the KernelT
+ * argument of BasicKernelCache / BasicSVM. Composition is expressed in
+ * the type, e.g.
+ *
+ *   static_kernel::Sum<static_kernel::RBF,
+ *                      static_kernel::Scaled<static_kernel::Linear>>
+ *
+ * so the whole expression is known to the compiler and can be inlined
+ * and vectorised, instead of paying one virtual call per node of a
+ * SumKernel / ProductKernel tree.
+ *
+ * The mathematics mirror rkhs_kernels.hpp and kernel_composition.hpp.
+ * make_kernel_function() wraps any of them back into a KernelFunction.
+ */
+namespace mlpp::classifiers::kernel::static_kernel
+{
+
+/**
+ * k(x, y) = <x, y>
+ */
+struct Linear
+{
+    [[nodiscard]]
+    double operator()(const Vector& x,
+                      const Vector& y) const noexcept;
+
+    [[nodiscard]]
+    double evaluate(const double* x,
+                    const double* y,
+                    std::size_t dim) const noexcept;
+};
+
+/**
+ * k(x, y) = (γ <x, y> + c)^d
+ */
+struct Polynomial
+{
+    double gamma = 1.0;
+    double coef0 = 0.0;
+    std::size_t degree = 3;
+
+    [[nodiscard]]
+    double operator()(const Vector& x,
+                      const Vector& y) const noexcept;
+
+    [[nodiscard]]
+    double evaluate(const double* x,
+                    const double* y,
+                    std::size_t dim) const noexcept;
+};
+
+/**
+ * k(x, y) = exp(-γ ||x - y||²)
+ */
+struct RBF
+{
+    double gamma = 1.0;
+
+    [[nodiscard]]
+    double operator()(const Vector& x,
+                      const Vector& y) const noexcept;
+
+    [[nodiscard]]
+    double evaluate(const double* x,
+                    const double* y,
+                    std::size_t dim) const noexcept;
+};
+
+/**
+ * k(x, y) = k₁(x, y) + k₂(x, y)
+ */
+template <KernelEvaluator K1, KernelEvaluator K2>
+struct Sum
+{
+    K1 k1;
+    K2 k2;
+
+    [[nodiscard]]
+    double operator()(const Vector& x,
+                      const Vector& y) const noexcept;
+
+    [[nodiscard]]
+    double evaluate(const double* x,
+                    const double* y,
+                    std::size_t dim) const noexcept;
+};
+
+/**
+ * k(x, y) = k₁(x, y) · k₂(x, y)
+ */
+template <KernelEvaluator K1, KernelEvaluator K2>
+struct Product
+{
+    K1 k1;
+    K2 k2;
+
+    [[nodiscard]]
+    double operator()(const Vector& x,
+                      const Vector& y) const noexcept;
+
+    [[nodiscard]]
+    double evaluate(const double* x,
+                    const double* y,
+                    std::size_t dim) const noexcept;
+};
+
+/**
+ * k(x, y) = α · k₀(x, y),   α ≥ 0
+ */
+template <KernelEvaluator K>
+struct Scaled
+{
+    double scale = 1.0;
+    K kernel;
+
+    [[nodiscard]]
+    double operator()(const Vector& x,
+                      const Vector& y) const noexcept;
+
+    [[nodiscard]]
+    double evaluate(const double* x,
+                    const double* y,
+                    std::size_t dim) const noexcept;
+};
+
+/**
+ * k(x, y) = exp( k₀(x, y) )
+ */
+template <KernelEvaluator K>
+struct Exponential
+{
+    K base;
+
+    [[nodiscard]]
+    double operator()(const Vector& x,
+                      const Vector& y) const noexcept;
+
+    [[nodiscard]]
+    double evaluate(const double* x,
+                    const double* y,
+                    std::size_t dim) const noexcept;
+};
+
+/**
+ * Type-erase a compile-time kernel into a KernelFunction.
+ */
+template <KernelEvaluator K>
+[[nodiscard]]
+KernelFunction make_kernel_function(K kernel);
+
+} // namespace mlpp::classifiers::kernel::static_kernel
+
+#include "static_kernels.inl"
@@ -0,0 +1,170 @@
+// include/Supervised Learning/Classifiers/SVM/Kernel/static_kernels.inl
+#pragma once
+
+#include <cmath>
+
+#include "static_kernels.hpp"
+#include "simd_kernels.hpp"
+
+namespace mlpp::classifiers::kernel::static_kernel
+{
+
+inline double
+Linear::operator()(const Vector& x,
+                   const Vector& y) const noexcept
+{
+    return evaluate(x.data(), y.data(), x.size());
+}
+
+inline double
+Linear::evaluate(const double* x,
+                 const double* y,
+                 std::size_t dim) const noexcept
+{
+    return simd::dot(x, y, dim);
+}
+
+inline double
+Polynomial::operator()(const Vector& x,
+                       const Vector& y) const noexcept
+{
+    return evaluate(x.data(), y.data(), x.size());
+}
+
+inline double
+Polynomial::evaluate(const double* x,
+                     const double* y,
+                     std::size_t dim) const noexcept
+{
+    return simd::ipow(gamma * simd::dot(x, y, dim) + coef0, degree);
+}
+
+inline double
+RBF::operator()(const Vector& x,
+                const Vector& y) const noexcept
+{
+    return evaluate(x.data(), y.data(), x.size());
+}
+
+inline double
+RBF::evaluate(const double* x,
+              const double* y,
+              std::size_t dim) const noexcept
+{
+    return std::exp(-gamma * simd::squared_distance(x, y, dim));
+}
+
+template <KernelEvaluator K1, KernelEvaluator K2>
+inline double
+Sum<K1, K2>::operator()(const Vector& x,
+                        const Vector& y) const noexcept
+{
+    return evaluate(x.data(), y.data(), x.size());
+}
+
+template <KernelEvaluator K1, KernelEvaluator K2>
+inline double
+Sum<K1, K2>::evaluate(const double* x,
+                      const double* y,
+                      std::size_t dim) const noexcept
+{
+    return k1.evaluate(x, y, dim) + k2.evaluate(x, y, dim);
+}
+
+template <KernelEvaluator K1, KernelEvaluator K2>
+inline double
+Product<K1, K2>::operator()(const Vector& x,
+                            const Vector& y) const noexcept
+{
+    return evaluate(x.data(), y.data(), x.size());
+}
+
+template <KernelEvaluator K1, KernelEvaluator K2>
+inline double
+Product<K1, K2>::evaluate(const double* x,
+                          const double* y,
+                          std::size_t dim) const noexcept
+{
+    return k1.evaluate(x, y, dim) * k2.evaluate(x, y, dim);
+}
+
+template <KernelEvaluator K>
+inline double
+Scaled<K>::operator()(const Vector& x,
+                      const Vector& y) const noexcept
+{
+    return evaluate(x.data(), y.data(), x.size());
+}
+
+template <KernelEvaluator K>
+inline double
+Scaled<K>::evaluate(const double* x,
+                    const double* y,
+                    std::size_t dim) const noexcept
+{
+    return scale * kernel.evaluate(x, y, dim);
+}
+
+template <KernelEvaluator K>
+inline double
+Exponential<K>::operator()(const Vector& x,
+                           const Vector& y) const noexcept
+{
+    return evaluate(x.data(), y.data(), x.size());
+}
+
+template <KernelEvaluator K>
+inline double
+Exponential<K>::evaluate(const double* x,
+                         const double* y,
+                         std::size_t dim) const noexcept
+{
+    return std::exp(base.evaluate(x, y, dim));
+}
+
+namespace detail
+{
+
+template <KernelEvaluator K>
+class ErasedKernel final : public Kernel
+{
+public:
+    explicit ErasedKernel(K kernel)
+        : kernel_(std::move(kernel))
+    {}
+
+    [[nodiscard]]
+    double operator()(const Vector& x,
+                      const Vector& y) const noexcept override
+    {
+        return kernel_(x, y);
+    }
+
+    [[nodiscard]]
+    double evaluate(const double* x,
+                    const double* y,
+                    std::size_t dim) const override
+    {
+        return kernel_.evaluate(x, y, dim);
+    }
+
+    [[nodiscard]]
+    std::unique_ptr<Kernel> clone() const override
+    {
+        return std::make_unique<ErasedKernel>(*this);
+    }
+
+private:
+    K kernel_;
+};
+
+} // namespace detail
+
+template <KernelEvaluator K>
+inline KernelFunction
+make_kernel_function(K kernel)
+{
+    return KernelFunction(std::make_unique<detail::ErasedKernel<K>>(std::move(kernel)));
+}
+
+} // namespace mlpp::classifiers::kernel::static_kernel
@@ -0,0 +1,88 @@
+// include/Supervised Learning/Classifiers/SVM/Kernel/subset_gram.hpp
+#pragma once
+
+#include <Eigen/Dense>
+#include <array>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cstddef>
+
+namespace mlpp::classifiers::kernel
+{
+
+/**
+ * @brief Gram matrix of a subset of samples, read from a shared cache.
+ *
+ * Local index t refers to sample index[t] of the underlying cache, so
+ * a solver can run on a sub-problem (one class pair, one CV fold, ...)
+ * without recomputing or copying the kernel matrix:
+ *
+ *     K^sub_{st} = K_{index[s], index[t]}.
+ *
+ * Rows are gathered into two private buffers, which keeps the two most
+ * recently returned rows valid together, as SMOSolver requires. The
+ * view never writes to the source; over a precomputed dense cache,
+ * views can therefore be used from different threads concurrently.
+ *
+ * @tparam Source  Full Gram access with size(), operator()(i, j) and
+ *                 row(i), e.g. BasicKernelCache. Rows are gathered in
+ *                 the source's entry type.
+ */
+template <typename Source>
+class SubsetGram
+{
+public:
+    using Scalar = std::remove_cvref_t<
+        decltype(*std::declval<const Source&>().row(std::size_t{}))>;
+    /**
+     * @param source  Gram matrix over all samples
+     * @param index   Sample index of each local row
+     */
+    SubsetGram(const Source& source,
+               std::vector<std::size_t> index);
+
+    /**
+     * @brief Number of samples in the subset.
+     */
+    [[nodiscard]]
+    std::size_t size() const noexcept;
+
+    [[nodiscard]]
+    double operator()(std::size_t s,
+                      std::size_t t) const;
+
+    /**
+     * @brief Local row s, gathered from the source row of index[s].
+     */
+    [[nodiscard]]
+    const Scalar* row(std::size_t s) const;
+
+    /**
+     * @brief Same as row(s); the gather is a copy, so every entry is
+     *        filled regardless of @p subset.
+     */
+    [[nodiscard]]
+    const Scalar* row(std::size_t s,
+                      const std::vector<std::size_t>& subset) const;
+
+    /**
+     * @brief Sample index of each local row.
+     */
+    [[nodiscard]]
+    const std::vector<std::size_t>& index() const noexcept;
+
+private:
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    const Source& source_;
+    std::vector<std::size_t> index_;
+
+    mutable Eigen::Matrix<Scalar, Eigen::Dynamic, 2> rows_;  // one column per buffer
+    mutable std::array<std::size_t, 2> owner_{ npos, npos };
+    mutable std::size_t recent_ = 0;                      // last buffer returned
+};
+
+} // namespace mlpp::classifiers::kernel
+
+#include "subset_gram.inl"
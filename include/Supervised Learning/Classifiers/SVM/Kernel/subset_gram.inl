@@ -0,0 +1,77 @@
+// include/Supervised Learning/Classifiers/SVM/Kernel/subset_gram.inl
+#pragma once
+
+#include <utility>
+
+#include "subset_gram.hpp"
+
+namespace mlpp::classifiers::kernel
+{
+
+template <typename Source>
+inline SubsetGram<Source>::SubsetGram(const Source& source,
+                                      std::vector<std::size_t> index)
+    : source_(source),
+      index_(std::move(index)),
+      rows_(index_.size(), 2)
+{
+}
+
+template <typename Source>
+inline std::size_t
+SubsetGram<Source>::size() const noexcept
+{
+    return index_.size();
+}
+
+template <typename Source>
+inline double
+SubsetGram<Source>::operator()(std::size_t s,
+                               std::size_t t) const
+{
+    return source_(index_[s], index_[t]);
+}
+
+template <typename Source>
+inline const typename SubsetGram<Source>::Scalar*
+SubsetGram<Source>::row(std::size_t s) const
+{
+    for (std::size_t b = 0; b < owner_.size(); ++b)
+    {
+        if (owner_[b] == s)
+        {
+            recent_ = b;
+            return rows_.col(static_cast<Eigen::Index>(b)).data();
+        }
+    }
+
+    // Overwrite the buffer that was not returned last.
+    const std::size_t b = 1 - recent_;
+    const Scalar* full = source_.row(index_[s]);
+    Scalar* out = rows_.col(static_cast<Eigen::Index>(b)).data();
+
+    for (std::size_t t = 0; t < index_.size(); ++t)
+        out[t] = full[index_[t]];
+
+    owner_[b] = s;
+    recent_ = b;
+
+    return out;
+}
+
+template <typename Source>
+inline const typename SubsetGram<Source>::Scalar*
+SubsetGram<Source>::row(std::size_t s,
+                        const std::vector<std::size_t>&) const
+{
+    return row(s);
+}
+
+template <typename Source>
+inline const std::vector<std::size_t>&
+SubsetGram<Source>::index() const noexcept
+{
+    return index_;
+}
+
+} // namespace mlpp::classifiers::kernel
@@ -2,6 +2,8 @@
 #pragma once
 
 #include "Kernel/kernel_cache.hpp"
+#include "smo_solver.hpp"
+#include "support_vector_model.hpp"
 
 #include <Eigen/Dense>
 #include <vector>
@@ -10,6 +12,35 @@
 namespace mlpp::classifiers::kernel
 {
 
+/**
+ * Training configuration for SVM.
+ */
+struct SVMOptions
+{
+    /**
+     * Kernel cache budget in bytes.
+     *
+     * 0 keeps the full n × n Gram matrix in memory. Any other value
+     * bounds the cache to that many bytes of kernel rows, evicted
+     * in LRU order, so training runs in O(budget) memory.
+     */
+    std::size_t cache_bytes = 0;
+
+    /**
+     * Layout of the unbounded cache (cache_bytes == 0).
+     *
+     * MulticlassSVM shares one full cache between its threads and
+     * ignores this setting.
+     */
+    CacheLayout layout = CacheLayout::full;
+
+    // Threads used to precompute the dense Gram matrix (0 = all).
+    std::size_t threads = 0;
+
+    // Stopping criteria for the SMO solver.
+    SMOOptions solver;
+};
+
 /**
  * Support Vector Machine (binary, kernelized)
  *
@@ -23,8 +54,18 @@ namespace mlpp::classifiers::kernel
  *
  * The optimization procedure is intentionally separated
  * from the mathematical structure.
+ *
+ * @tparam KernelT  Kernel evaluator. SVM (= BasicSVM<KernelFunction>)
+ *                  is configured at runtime; a static_kernel type,
+ *                  including composition trees such as
+ *                  static_kernel::Sum<RBF, Linear>, removes virtual
+ *                  dispatch from the cache fill and scoring loops.
+ * @tparam Scalar   Storage type of the kernel cache; float halves its
+ *                  memory (twice as many resident rows in bounded
+ *                  mode) while the solver still works in double.
  */
-class SVM
+template <KernelEvaluator KernelT, std::floating_point Scalar = double>
+class BasicSVM
 {
 public:
     using LabelVector = Eigen::VectorXd;
@@ -37,27 +78,113 @@ public:
      * @param labels Class labels in {−1, +1}
      * @param kernel Kernel function
      * @param C      Soft margin penalty parameter
+     * @param options Training configuration
      */
-    SVM(const std::vector<Vector>& data,
-        LabelVector labels,
-        KernelFunction kernel,
-        double C);
+    BasicSVM(const std::vector<Vector>& data,
+             LabelVector labels,
+             KernelT kernel,
+             double C,
+             SVMOptions options = {});
 
     /**
      * Train the SVM model.
      *
-     * Optimization strategy is implementation-defined.
+     * Runs SMOSolver (second-order working set selection) from α = 0,
+     * then finalizes the compact support-vector model.
+     *
+     * @return Iteration count and final KKT gap of the run.
+     */
+    SolverReport fit();
+
+    /**
+     * Resume training from the current α.
+     *
+     * Same as fit(), but the solver starts from the dual variables
+     * left by a previous fit(), warm_start(), append() or remove().
+     * When the data changed little the starting point is close to
+     * the optimum and far fewer iterations are needed.
+     */
+    SolverReport refit();
+
+    /**
+     * Seed the dual variables, e.g. from a previous model.
+     *
+     * α is clipped to [0, C] and, if needed, scaled on one side so
+     * that Σ α_i y_i = 0 holds. The compact model is rebuilt from the
+     * seeded values; call refit() to converge from them.
+     *
+     * @param alpha  One value per training sample
+     * @param bias   Offset b of the decision function
+     */
+    void warm_start(AlphaVector alpha, double bias);
+
+    /**
+     * Register samples appended to the training data.
+     *
+     * Call after labels.size() samples have been pushed onto the
+     * dataset passed to the constructor. The new samples start with
+     * α_i = 0 and cached kernel entries of the old ones are kept.
+     */
+    void append(const LabelVector& labels);
+
+    /**
+     * Register samples erased from the training data.
+     *
+     * Call after the samples at @p indices (positions before the
+     * erase) have been removed from the dataset passed to the
+     * constructor. Their α_i are dropped and the rest rescaled to
+     * keep Σ α_i y_i = 0; cached kernel entries of the remaining
+     * samples are kept. model() is unchanged until the next refit().
+     */
+    void remove(const std::vector<std::size_t>& indices);
+
+    /**
+     * Dual variables α, one per training sample.
+     */
+    [[nodiscard]]
+    const AlphaVector& alpha() const noexcept;
+
+    /**
+     * Offset b of the decision function.
+     */
+    [[nodiscard]]
+    double bias() const noexcept;
+
+    /**
+     * Rebuild the compact model from the current α and b.
+     *
+     * Copies the support vectors (α_i > 0) into a contiguous buffer
+     * with coefficients α_i y_i. Called by fit().
      */
-    void fit();
+    void finalize();
+
+    /**
+     * Compact model used for inference.
+     *
+     * Independent of the training data; copy it out to keep scoring
+     * after the training set has been released.
+     */
+    [[nodiscard]]
+    const BasicSupportVectorModel<KernelT>& model() const noexcept;
 
     /**
      * Evaluate the decision function:
      *
      *   f(x) = Σ α_i y_i K(x_i, x) + b
+     *
+     * Only support vectors are visited.
      */
     [[nodiscard]]
     double decision(const Vector& x) const;
 
+    /**
+     * Evaluate the decision function for one query per row of Q.
+     *
+     * See BasicSupportVectorModel::decision_batch.
+     */
+    [[nodiscard]]
+    Eigen::VectorXd decision_batch(const Eigen::MatrixXd& Q) const;
+
     /**
      * Predict class label (+1 or -1).
      */
@@ -70,23 +197,31 @@ public:
 
 private:
     /**
-     * Compute bias term using support vectors.
+     * Clip α to [0, C] and restore Σ α_i y_i = 0.
      */
-    void compute_bias();
+    void make_feasible();
 
 private:
     const std::vector<Vector>& data_;
     LabelVector labels_;
-    Eigen::VectorXd error_;
 
     double C_;
+    SMOOptions solver_options_;
+    std::size_t threads_;
 
-    KernelCache kernel_cache_;
+    BasicKernelCache<KernelT, Scalar> kernel_cache_;
 
     AlphaVector alpha_;
     double bias_;
+
+    BasicSupportVectorModel<KernelT> model_;
 };
 
+/**
+ * Runtime-polymorphic SVM.
+ */
+using SVM = BasicSVM<KernelFunction>;
+
 } // namespace mlpp::classifiers::kernel
 
 #include "SVM.inl"
\ No newline at end of file
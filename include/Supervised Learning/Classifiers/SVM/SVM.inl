@@ -2,219 +2,214 @@
 #pragma once
 
 #include <algorithm>
-#include <random>
 #include <cmath>
-#include <limits>
+#include <stdexcept>
 
 #include "SVM.hpp"
 
 namespace mlpp::classifiers::kernel
 {
 
+template <KernelEvaluator KernelT, std::floating_point Scalar>
 inline
-SVM::SVM(const std::vector<Vector>& data,
-         LabelVector labels,
-         KernelFunction kernel,
-         double C)
+BasicSVM<KernelT, Scalar>::BasicSVM(const std::vector<Vector>& data,
+                            LabelVector labels,
+                            KernelT kernel,
+                            double C,
+                            SVMOptions options)
     : data_(data),
       labels_(std::move(labels)),
       C_(C),
-      kernel_cache_(data_, std::move(kernel)),
+      solver_options_(options.solver),
+      threads_(options.threads),
+      kernel_cache_(options.cache_bytes == 0
+                        ? BasicKernelCache<KernelT, Scalar>(data_, std::move(kernel),
+                                                            options.layout)
+                        : BasicKernelCache<KernelT, Scalar>(data_, std::move(kernel),
+                                                            options.cache_bytes)),
       alpha_(AlphaVector::Zero(data_.size())),
-      bias_(0.0),
-      error_(Eigen::VectorXd::Zero(data_.size()))
+      bias_(0.0)
 {
 }
 
+template <KernelEvaluator KernelT, std::floating_point Scalar>
 inline
-double SVM::decision(const Vector& x) const
+double BasicSVM<KernelT, Scalar>::decision(const Vector& x) const
 {
-    double value = bias_;
+    return model_.decision(x);
+}
+
+template <KernelEvaluator KernelT, std::floating_point Scalar>
+inline
+Eigen::VectorXd BasicSVM<KernelT, Scalar>::decision_batch(const Eigen::MatrixXd& Q) const
+{
+    return model_.decision_batch(Q);
+}
+
+template <KernelEvaluator KernelT, std::floating_point Scalar>
+inline
+int BasicSVM<KernelT, Scalar>::predict(const Vector& x) const
+{
+    return model_.predict(x);
+}
+
+template <KernelEvaluator KernelT, std::floating_point Scalar>
+inline
+void BasicSVM<KernelT, Scalar>::finalize()
+{
+    const std::vector<std::size_t> sv = support_indices(0.0);
+    const std::size_t dim = data_.empty() ? 0 : data_.front().size();
 
-    const std::size_t n = data_.size();
+    typename BasicSupportVectorModel<KernelT>::RowMatrix vectors(sv.size(), dim);
+    Eigen::VectorXd coef(sv.size());
 
-    for (std::size_t i = 0; i < n; ++i)
+    for (std::size_t r = 0; r < sv.size(); ++r)
     {
-        if (alpha_(i) > 0.0)
-        {
-            value += alpha_(i) * labels_(i)
-                   * kernel_cache_.kernel()(data_[i], x);
-        }
+        const Vector& x = data_[sv[r]];
+        std::copy(x.begin(), x.end(), vectors.row(r).data());
+        coef(r) = alpha_(sv[r]) * labels_(sv[r]);
     }
 
-    return value;
+    model_ = BasicSupportVectorModel<KernelT>(std::move(vectors),
+                                              std::move(coef),
+                                              bias_,
+                                              kernel_cache_.kernel());
+}
+
+template <KernelEvaluator KernelT, std::floating_point Scalar>
+inline const BasicSupportVectorModel<KernelT>&
+BasicSVM<KernelT, Scalar>::model() const noexcept
+{
+    return model_;
+}
+
+template <KernelEvaluator KernelT, std::floating_point Scalar>
+inline SolverReport BasicSVM<KernelT, Scalar>::fit()
+{
+    alpha_.setZero();
+    bias_ = 0.0;
+
+    return refit();
+}
+
+template <KernelEvaluator KernelT, std::floating_point Scalar>
+inline SolverReport BasicSVM<KernelT, Scalar>::refit()
+{
+    // Only entries not already cached are evaluated here.
+    if (!kernel_cache_.bounded())
+        kernel_cache_.precompute(threads_);
+
+    SMOSolver solver(kernel_cache_, labels_, C_, solver_options_);
+    const SolverReport report = solver.solve(alpha_, bias_);
+
+    finalize();
+
+    return report;
 }
 
+template <KernelEvaluator KernelT, std::floating_point Scalar>
 inline
-int SVM::predict(const Vector& x) const
+void BasicSVM<KernelT, Scalar>::warm_start(AlphaVector alpha, double bias)
 {
-    return decision(x) >= 0.0 ? +1 : -1;
+    if (static_cast<std::size_t>(alpha.size()) != data_.size())
+        throw std::invalid_argument(
+            "SVM::warm_start: alpha size does not match the dataset");
+
+    alpha_ = std::move(alpha);
+    bias_ = bias;
+
+    make_feasible();
+    finalize();
+}
+
+template <KernelEvaluator KernelT, std::floating_point Scalar>
+inline
+void BasicSVM<KernelT, Scalar>::append(const LabelVector& labels)
+{
+    const auto old_n = labels_.size();
+    const auto count = labels.size();
+
+    kernel_cache_.append(static_cast<std::size_t>(count));
+
+    labels_.conservativeResize(old_n + count);
+    labels_.tail(count) = labels;
+
+    alpha_.conservativeResize(old_n + count);
+    alpha_.tail(count).setZero();
 }
 
+template <KernelEvaluator KernelT, std::floating_point Scalar>
 inline
-void SVM::compute_bias()
+void BasicSVM<KernelT, Scalar>::remove(const std::vector<std::size_t>& indices)
 {
-    const std::size_t n = data_.size();
+    kernel_cache_.remove(indices);
 
-    double sum = 0.0;
-    std::size_t count = 0;
+    std::vector<bool> erased(static_cast<std::size_t>(labels_.size()), false);
+    for (std::size_t i : indices)
+        erased[i] = true;
 
-    for (std::size_t i = 0; i < n; ++i)
+    Eigen::Index k = 0;
+    for (Eigen::Index i = 0; i < labels_.size(); ++i)
     {
-        if (alpha_(i) > 0.0 && alpha_(i) < C_)
-        {
-            double s = 0.0;
-
-            for (std::size_t j = 0; j < n; ++j)
-            {
-                if (alpha_(j) > 0.0)
-                {
-                    s += alpha_(j) * labels_(j)
-                       * kernel_cache_(j, i);
-                }
-            }
-
-            sum += labels_(i) - s;
-            ++count;
-        }
+        if (erased[static_cast<std::size_t>(i)])
+            continue;
+
+        labels_(k) = labels_(i);
+        alpha_(k) = alpha_(i);
+        ++k;
     }
 
-    if (count > 0)
-        bias_ = sum / static_cast<double>(count);
+    labels_.conservativeResize(k);
+    alpha_.conservativeResize(k);
+
+    make_feasible();
 }
 
-inline void SVM::fit()
+template <KernelEvaluator KernelT, std::floating_point Scalar>
+inline
+void BasicSVM<KernelT, Scalar>::make_feasible()
 {
-    const std::size_t n = data_.size();
+    alpha_ = alpha_.cwiseMax(0.0).cwiseMin(C_);
 
-    kernel_cache_.precompute();
+    // Σ_{y=+1} α − Σ_{y=−1} α = s; shrink the heavier side by |s|.
+    const double s = alpha_.dot(labels_);
 
-    constexpr double tol = 1e-3;           // KKT tolerance
-    constexpr double eps = 1e-5;           // minimal alpha step
-    constexpr std::size_t max_passes = 10; // SMO stopping criterion
+    if (s == 0.0)
+        return;
 
-    error_ = -labels_;
+    double side = 0.0;
+    for (Eigen::Index i = 0; i < alpha_.size(); ++i)
+    {
+        if (labels_(i) * s > 0.0)
+            side += alpha_(i);
+    }
 
-    std::size_t passes = 0;
+    const double scale = side > 0.0 ? (side - std::abs(s)) / side : 0.0;
 
-    while (passes < max_passes)
+    for (Eigen::Index i = 0; i < alpha_.size(); ++i)
     {
-        std::size_t num_changed = 0;
-
-        for (std::size_t i = 0; i < n; ++i)
-        {
-            const double Ei = error_(i);       // cached error
-            const double yi = labels_(i);      // label
-            const double ai_old = alpha_(i);   // previous alpha_i
-
-            const bool violates_kkt =
-                (yi * Ei < -tol && ai_old < C_) ||
-                (yi * Ei >  tol && ai_old > 0.0);
-
-            if (!violates_kkt)
-                continue;
-
-            std::size_t j = i;
-            double max_delta = 0.0;
-
-            for (std::size_t k = 0; k < n; ++k)
-            {
-                if (k == i)
-                    continue;
-
-                const double delta = std::abs(Ei - error_(k));
-                if (delta > max_delta)
-                {
-                    max_delta = delta;
-                    j = k;
-                }
-            }
-
-            if (j == i)
-                continue;
-
-            const double Ej = error_(j);     // cached error_j
-            const double yj = labels_(j);    // label_j
-            const double aj_old = alpha_(j); // previous alpha_j
-
-            double L, H; // feasible interval
-
-            if (yi != yj)
-            {
-                L = std::max(0.0, aj_old - ai_old);
-                H = std::min(C_, C_ + aj_old - ai_old);
-            }
-            else
-            {
-                L = std::max(0.0, ai_old + aj_old - C_);
-                H = std::min(C_, ai_old + aj_old);
-            }
-
-            if (L >= H)
-                continue;
-
-            const double kii = kernel_cache_(i, i);
-            const double kjj = kernel_cache_(j, j);
-            const double kij = kernel_cache_(i, j);
-
-            const double eta = 2.0 * kij - kii - kjj; // second derivative
-
-            if (eta >= 0.0)
-                continue;
-
-            alpha_(j) -= yj * (Ei - Ej) / eta; // unconstrained update
-            alpha_(j) = std::clamp(alpha_(j), L, H); // project to box
-
-            if (std::abs(alpha_(j) - aj_old) < eps)
-            {
-                alpha_(j) = aj_old;
-                continue;
-            }
-
-            alpha_(i) += yi * yj * (aj_old - alpha_(j));
-
-            const double b_old = bias_;
-
-            const double b1 =
-                bias_ - Ei
-                - yi * (alpha_(i) - ai_old) * kii
-                - yj * (alpha_(j) - aj_old) * kij;
-
-            const double b2 =
-                bias_ - Ej
-                - yi * (alpha_(i) - ai_old) * kij
-                - yj * (alpha_(j) - aj_old) * kjj;
-
-            if (alpha_(i) > 0.0 && alpha_(i) < C_)
-                bias_ = b1;
-            else if (alpha_(j) > 0.0 && alpha_(j) < C_)
-                bias_ = b2;
-            else
-                bias_ = 0.5 * (b1 + b2);
-
-            for (std::size_t k = 0; k < n; ++k)
-            {
-                error_(k) +=
-                    (alpha_(i) - ai_old) * yi * kernel_cache_(i, k) +
-                    (alpha_(j) - aj_old) * yj * kernel_cache_(j, k) +
-                    (bias_ - b_old);
-            }
-
-            ++num_changed;
-        }
-
-        if (num_changed == 0)
-            ++passes;
-        else
-            passes = 0;
+        if (labels_(i) * s > 0.0)
+            alpha_(i) *= std::max(0.0, scale);
     }
+}
 
-    compute_bias();
+template <KernelEvaluator KernelT, std::floating_point Scalar>
+inline const typename BasicSVM<KernelT, Scalar>::AlphaVector&
+BasicSVM<KernelT, Scalar>::alpha() const noexcept
+{
+    return alpha_;
+}
+
+template <KernelEvaluator KernelT, std::floating_point Scalar>
+inline double BasicSVM<KernelT, Scalar>::bias() const noexcept
+{
+    return bias_;
 }
 
+template <KernelEvaluator KernelT, std::floating_point Scalar>
 inline
 std::vector<std::size_t>
-SVM::support_indices(double eps) const
+BasicSVM<KernelT, Scalar>::support_indices(double eps) const
 {
     std::vector<std::size_t> indices;
     indices.reserve(data_.size());
@@ -0,0 +1,150 @@
+// include/Supervised Learning/Classifiers/SVM/feature_maps.hpp
+#pragma once
+
+#include "support_vector_model.hpp"
+
+#include <Eigen/Dense>
+#include <vector>
+#include <cstddef>
+
+namespace mlpp::classifiers::kernel
+{
+
+/**
+ * Explicit features, one sample per row, for training a linear model.
+ */
+using FeatureMatrix =
+    Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+/**
+ * Random Fourier features for the RBF kernel (Rahimi & Recht 2007).
+ *
+ * By Bochner's theorem the Gaussian kernel is the Fourier transform of
+ * the density N(0, 2γ I), so with w_j ~ N(0, 2γ I) and b_j ~ U[0, 2π]
+ *
+ *   z(x) = √(2/m) [cos(w_1ᵀ x + b_1), ..., cos(w_mᵀ x + b_m)]
+ *
+ * satisfies E[z(x)ᵀ z(y)] = exp(−γ ‖x − y‖²). Mapping n samples costs
+ * one n × d × m matrix product instead of an n × n Gram matrix, and a
+ * linear model on z(x) scores with a single dot product.
+ */
+class RandomFourierFeatures
+{
+public:
+    /**
+     * @param gamma       RBF width γ
+     * @param components  Number of features m
+     * @param seed        RNG seed for the frequencies and phases
+     */
+    RandomFourierFeatures(double gamma,
+                          std::size_t components,
+                          std::size_t seed = 0);
+
+    RandomFourierFeatures(const RBFKernel& kernel,
+                          std::size_t components,
+                          std::size_t seed = 0);
+
+    /**
+     * Draw the frequencies for the dimension of @p data.
+     *
+     * Only the dimension is used; the map does not depend on the
+     * samples themselves.
+     */
+    void fit(const std::vector<Vector>& data);
+
+    /**
+     * Map every sample to its m features (n × m).
+     */
+    [[nodiscard]]
+    FeatureMatrix transform(const std::vector<Vector>& data) const;
+
+    /**
+     * Map a single sample.
+     */
+    [[nodiscard]]
+    Eigen::VectorXd transform(const Vector& x) const;
+
+    [[nodiscard]]
+    std::size_t components() const noexcept;
+
+private:
+    double gamma_;
+    std::size_t components_;
+    std::size_t seed_;
+
+    Eigen::MatrixXd W_;        // d × m frequencies
+    Eigen::RowVectorXd b_;     // phases
+};
+
+/**
+ * Nyström approximation of an arbitrary kernel (Williams & Seeger 2001).
+ *
+ * Picks k landmarks L uniformly from the training set and maps
+ *
+ *   z(x) = K_LL^{−1/2} K(L, x),
+ *
+ * so that z(x)ᵀ z(y) = K(x, L) K_LL⁺ K(L, y) ≈ K(x, y). The inverse
+ * square root is taken on the eigenvalues of K_LL, dropping those
+ * below eigen_floor. Mapping costs O(n·k) kernel evaluations, obtained
+ * by one matrix product for the dot-product kernels (see
+ * BasicSupportVectorSet::kernel_block).
+ *
+ * @tparam KernelT  Kernel evaluator, see BasicKernelCache.
+ */
+template <KernelEvaluator KernelT>
+class BasicNystroem
+{
+public:
+    /**
+     * @param kernel      Kernel to approximate
+     * @param components  Number of landmarks k (capped at n by fit)
+     * @param seed        RNG seed for landmark selection
+     */
+    BasicNystroem(KernelT kernel,
+                  std::size_t components,
+                  std::size_t seed = 0);
+
+    /**
+     * Select the landmarks and factor K_LL.
+     */
+    void fit(const std::vector<Vector>& data);
+
+    /**
+     * Map every sample to its k features (n × k).
+     */
+    [[nodiscard]]
+    FeatureMatrix transform(const std::vector<Vector>& data) const;
+
+    /**
+     * Map a single sample.
+     */
+    [[nodiscard]]
+    Eigen::VectorXd transform(const Vector& x) const;
+
+    // Number of landmarks actually in use.
+    [[nodiscard]]
+    std::size_t components() const noexcept;
+
+    [[nodiscard]]
+    const BasicSupportVectorSet<KernelT>& landmarks() const noexcept;
+
+private:
+    static constexpr double eigen_floor = 1e-12;
+    static constexpr Eigen::Index batch_block = 1024;
+
+    KernelT kernel_;
+    std::size_t components_;
+    std::size_t seed_;
+
+    BasicSupportVectorSet<KernelT> landmarks_;
+    Eigen::MatrixXd normalization_;   // K_LL^{−1/2}
+};
+
+/**
+ * Runtime-polymorphic Nyström map.
+ */
+using Nystroem = BasicNystroem<KernelFunction>;
+
+} // namespace mlpp::classifiers::kernel
+
+#include "feature_maps.inl"
@@ -0,0 +1,237 @@
+// include/Supervised Learning/Classifiers/SVM/feature_maps.inl
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <numbers>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+
+#include "feature_maps.hpp"
+
+namespace mlpp::classifiers::kernel
+{
+
+namespace detail
+{
+
+/**
+ * Copy samples [begin, begin + count) into the rows of a dense matrix.
+ */
+inline Eigen::MatrixXd pack_rows(const std::vector<Vector>& data,
+                                 std::size_t begin,
+                                 std::size_t count,
+                                 std::size_t dim)
+{
+    Eigen::MatrixXd X(static_cast<Eigen::Index>(count),
+                      static_cast<Eigen::Index>(dim));
+
+    for (std::size_t r = 0; r < count; ++r)
+    {
+        const Vector& x = data[begin + r];
+        for (std::size_t k = 0; k < dim; ++k)
+            X(r, k) = x[k];
+    }
+
+    return X;
+}
+
+} // namespace detail
+
+inline
+RandomFourierFeatures::RandomFourierFeatures(double gamma,
+                                             std::size_t components,
+                                             std::size_t seed)
+    : gamma_(gamma),
+      components_(components),
+      seed_(seed)
+{
+    if (gamma_ <= 0.0)
+        throw std::invalid_argument("RandomFourierFeatures: gamma must be > 0.");
+    if (components_ == 0)
+        throw std::invalid_argument("RandomFourierFeatures: components must be > 0.");
+}
+
+inline
+RandomFourierFeatures::RandomFourierFeatures(const RBFKernel& kernel,
+                                             std::size_t components,
+                                             std::size_t seed)
+    : RandomFourierFeatures(kernel.gamma(), components, seed)
+{
+}
+
+inline
+void RandomFourierFeatures::fit(const std::vector<Vector>& data)
+{
+    if (data.empty())
+        throw std::invalid_argument("RandomFourierFeatures::fit: data must be non-empty.");
+
+    const auto dim = static_cast<Eigen::Index>(data.front().size());
+    const auto m = static_cast<Eigen::Index>(components_);
+
+    std::mt19937 rng(seed_);
+    std::normal_distribution<double> frequency(0.0, std::sqrt(2.0 * gamma_));
+    std::uniform_real_distribution<double> phase(0.0, 2.0 * std::numbers::pi);
+
+    W_.resize(dim, m);
+    b_.resize(m);
+
+    for (Eigen::Index j = 0; j < m; ++j)
+    {
+        for (Eigen::Index k = 0; k < dim; ++k)
+            W_(k, j) = frequency(rng);
+
+        b_(j) = phase(rng);
+    }
+}
+
+inline
+FeatureMatrix RandomFourierFeatures::transform(const std::vector<Vector>& data) const
+{
+    if (W_.size() == 0)
+        throw std::logic_error("RandomFourierFeatures::transform: call fit() first.");
+
+    const Eigen::MatrixXd X =
+        detail::pack_rows(data, 0, data.size(), static_cast<std::size_t>(W_.rows()));
+
+    FeatureMatrix Z(X.rows(), W_.cols());
+    Z.noalias() = X * W_;
+    Z.rowwise() += b_;
+
+    const double scale = std::sqrt(2.0 / static_cast<double>(components_));
+    Z = scale * Z.array().cos();
+
+    return Z;
+}
+
+inline
+Eigen::VectorXd RandomFourierFeatures::transform(const Vector& x) const
+{
+    if (W_.size() == 0)
+        throw std::logic_error("RandomFourierFeatures::transform: call fit() first.");
+
+    const Eigen::Map<const Eigen::VectorXd> v(x.data(), W_.rows());
+
+    const double scale = std::sqrt(2.0 / static_cast<double>(components_));
+    Eigen::VectorXd z = W_.transpose() * v + b_.transpose();
+
+    return scale * z.array().cos();
+}
+
+inline std::size_t
+RandomFourierFeatures::components() const noexcept
+{
+    return components_;
+}
+
+template <KernelEvaluator KernelT>
+inline
+BasicNystroem<KernelT>::BasicNystroem(KernelT kernel,
+                                      std::size_t components,
+                                      std::size_t seed)
+    : kernel_(std::move(kernel)),
+      components_(components),
+      seed_(seed)
+{
+    if (components_ == 0)
+        throw std::invalid_argument("Nystroem: components must be > 0.");
+}
+
+template <KernelEvaluator KernelT>
+inline
+void BasicNystroem<KernelT>::fit(const std::vector<Vector>& data)
+{
+    if (data.empty())
+        throw std::invalid_argument("Nystroem::fit: data must be non-empty.");
+
+    const std::size_t n = data.size();
+    const std::size_t k = std::min(components_, n);
+    const std::size_t dim = data.front().size();
+
+    std::vector<std::size_t> all(n);
+    std::iota(all.begin(), all.end(), 0);
+
+    std::vector<std::size_t> chosen;
+    chosen.reserve(k);
+
+    std::mt19937 rng(seed_);
+    std::sample(all.begin(), all.end(), std::back_inserter(chosen), k, rng);
+
+    typename BasicSupportVectorSet<KernelT>::RowMatrix L(k, dim);
+    for (std::size_t r = 0; r < k; ++r)
+        std::copy(data[chosen[r]].begin(), data[chosen[r]].end(), L.row(r).data());
+
+    landmarks_ = BasicSupportVectorSet<KernelT>(L, kernel_);
+
+    // K_LL = U Λ Uᵀ  →  K_LL^{−1/2} = U Λ^{−1/2} Uᵀ on the retained spectrum.
+    Eigen::MatrixXd W;
+    landmarks_.kernel_block(Eigen::MatrixXd(L), W);
+
+    const Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> eig(W);
+
+    const Eigen::VectorXd inv_sqrt = eig.eigenvalues().unaryExpr([](double lambda)
+    {
+        return lambda > eigen_floor ? 1.0 / std::sqrt(lambda) : 0.0;
+    });
+
+    normalization_ = eig.eigenvectors() * inv_sqrt.asDiagonal()
+                   * eig.eigenvectors().transpose();
+}
+
+template <KernelEvaluator KernelT>
+inline
+FeatureMatrix BasicNystroem<KernelT>::transform(const std::vector<Vector>& data) const
+{
+    if (landmarks_.size() == 0)
+        throw std::logic_error("Nystroem::transform: call fit() first.");
+
+    const std::size_t n = data.size();
+    const std::size_t dim = static_cast<std::size_t>(landmarks_.vectors().cols());
+
+    FeatureMatrix Z(static_cast<Eigen::Index>(n), normalization_.cols());
+    Eigen::MatrixXd C;
+
+    for (std::size_t start = 0; start < n; start += batch_block)
+    {
+        const std::size_t len = std::min<std::size_t>(batch_block, n - start);
+
+        landmarks_.kernel_block(detail::pack_rows(data, start, len, dim), C);
+
+        // K_LL^{−1/2} is symmetric: rows of Cᵀ N are z(x)ᵀ.
+        Z.middleRows(static_cast<Eigen::Index>(start), static_cast<Eigen::Index>(len))
+            .noalias() = C.transpose() * normalization_;
+    }
+
+    return Z;
+}
+
+template <KernelEvaluator KernelT>
+inline
+Eigen::VectorXd BasicNystroem<KernelT>::transform(const Vector& x) const
+{
+    if (landmarks_.size() == 0)
+        throw std::logic_error("Nystroem::transform: call fit() first.");
+
+    Eigen::VectorXd c;
+    landmarks_.kernel_row(x, c);
+
+    return normalization_ * c;
+}
+
+template <KernelEvaluator KernelT>
+inline std::size_t
+BasicNystroem<KernelT>::components() const noexcept
+{
+    return landmarks_.size();
+}
+
+template <KernelEvaluator KernelT>
+inline const BasicSupportVectorSet<KernelT>&
+BasicNystroem<KernelT>::landmarks() const noexcept
+{
+    return landmarks_;
+}
+
+} // namespace mlpp::classifiers::kernel
@@ -0,0 +1,150 @@
+// include/Supervised Learning/Classifiers/SVM/linear_svm.hpp
+#pragma once
+
+#include "feature_maps.hpp"
+#include "smo_solver.hpp"
+
+#include <Eigen/Dense>
+#include <Eigen/SparseCore>
+#include <cstddef>
+
+namespace mlpp::classifiers::kernel
+{
+
+/**
+ * Sparse samples, one per row.
+ */
+using SparseFeatureMatrix = Eigen::SparseMatrix<double, Eigen::RowMajor>;
+
+/**
+ * Loss of the linear SVM primal.
+ */
+enum class LinearSVMLoss
+{
+    // max(0, 1 − y wᵀx):  box constraint 0 ≤ α_i ≤ C
+    hinge,
+
+    // max(0, 1 − y wᵀx)²: α_i ≥ 0, diagonal shift 1 / (2C)
+    squared_hinge
+};
+
+/**
+ * Training configuration for LinearSVM.
+ */
+struct LinearSVMOptions
+{
+    LinearSVMLoss loss = LinearSVMLoss::squared_hinge;
+
+    // Stop once the projected-gradient spread max PG − min PG drops below this.
+    double tolerance = 0.1;
+
+    // Hard cap on passes over the data.
+    std::size_t max_epochs = 1000;
+
+    /**
+     * Value of the constant feature appended for the bias (0 = no bias).
+     *
+     * As in LIBLINEAR the bias is learned as an ordinary weight, and so
+     * is regularised as well.
+     */
+    double bias_scale = 1.0;
+
+    // Temporarily drop variables pinned at a bound from the epoch.
+    bool shrinking = true;
+
+    // RNG seed for the per-epoch visiting order.
+    std::size_t seed = 0;
+};
+
+/**
+ * Linear SVM trained by dual coordinate descent (Hsieh et al. 2008).
+ *
+ * Solves the same dual as SVM for K(x, y) = xᵀy, but keeps the primal
+ * weight vector
+ *
+ *   w = Σ α_i y_i x_i
+ *
+ * explicit. Each coordinate step then needs only one row:
+ *
+ *   G_i = y_i wᵀx_i − 1 + D_ii α_i
+ *   α_i ← min(max(α_i − G_i / Q̄_ii, 0), U),   w ← w + Δα_i y_i x_i
+ *
+ * with Q̄_ii = ‖x_i‖² + D_ii. An epoch therefore costs O(nnz(X)) and no
+ * Gram matrix is ever formed; prediction is a single dot product. Use
+ * it instead of SVM with LinearKernel, or on RandomFourierFeatures and
+ * Nystroem outputs.
+ */
+class LinearSVM
+{
+public:
+    /**
+     * @param C        Soft margin penalty
+     * @param options  Loss and stopping criteria
+     */
+    explicit LinearSVM(double C,
+                       LinearSVMOptions options = {});
+
+    /**
+     * Train on dense samples.
+     *
+     * @param X       One sample per row (n × d)
+     * @param labels  Class labels in {−1, +1}
+     * @return        Epoch count (as iterations) and final PG spread.
+     */
+    SolverReport fit(const FeatureMatrix& X,
+                     const Eigen::VectorXd& labels);
+
+    /**
+     * Train on sparse samples; epochs touch only stored entries.
+     */
+    SolverReport fit(const SparseFeatureMatrix& X,
+                     const Eigen::VectorXd& labels);
+
+    /**
+     * Evaluate f(x) = wᵀx + b.
+     */
+    [[nodiscard]]
+    double decision(const Vector& x) const;
+
+    /**
+     * Evaluate f for every row of X.
+     */
+    [[nodiscard]]
+    Eigen::VectorXd decision_batch(const FeatureMatrix& X) const;
+
+    [[nodiscard]]
+    Eigen::VectorXd decision_batch(const SparseFeatureMatrix& X) const;
+
+    /**
+     * Predict class label (+1 or -1).
+     */
+    [[nodiscard]]
+    int predict(const Vector& x) const;
+
+    [[nodiscard]]
+    const Eigen::VectorXd& weights() const noexcept;
+
+    [[nodiscard]]
+    double bias() const noexcept;
+
+    // Dual variables of the last fit.
+    [[nodiscard]]
+    const Eigen::VectorXd& alpha() const noexcept;
+
+private:
+    template <typename MatrixT>
+    SolverReport solve(const MatrixT& X,
+                       const Eigen::VectorXd& labels);
+
+private:
+    double C_;
+    LinearSVMOptions options_;
+
+    Eigen::VectorXd w_;
+    double bias_ = 0.0;
+    Eigen::VectorXd alpha_;
+};
+
+} // namespace mlpp::classifiers::kernel
+
+#include "linear_svm.inl"
@@ -0,0 +1,271 @@
+// include/Supervised Learning/Classifiers/SVM/linear_svm.inl
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+
+#include "linear_svm.hpp"
+
+namespace mlpp::classifiers::kernel
+{
+
+namespace detail
+{
+
+inline double row_dot(const FeatureMatrix& X,
+                      Eigen::Index i,
+                      const Eigen::VectorXd& w)
+{
+    return w.dot(X.row(i).transpose());
+}
+
+inline double row_dot(const SparseFeatureMatrix& X,
+                      Eigen::Index i,
+                      const Eigen::VectorXd& w)
+{
+    double sum = 0.0;
+    for (SparseFeatureMatrix::InnerIterator it(X, i); it; ++it)
+        sum += it.value() * w(it.index());
+
+    return sum;
+}
+
+// w ← w + a x_i
+inline void row_axpy(const FeatureMatrix& X,
+                     Eigen::Index i,
+                     double a,
+                     Eigen::VectorXd& w)
+{
+    w.noalias() += a * X.row(i).transpose();
+}
+
+inline void row_axpy(const SparseFeatureMatrix& X,
+                     Eigen::Index i,
+                     double a,
+                     Eigen::VectorXd& w)
+{
+    for (SparseFeatureMatrix::InnerIterator it(X, i); it; ++it)
+        w(it.index()) += a * it.value();
+}
+
+inline double row_squared_norm(const FeatureMatrix& X,
+                               Eigen::Index i)
+{
+    return X.row(i).squaredNorm();
+}
+
+inline double row_squared_norm(const SparseFeatureMatrix& X,
+                               Eigen::Index i)
+{
+    double sum = 0.0;
+    for (SparseFeatureMatrix::InnerIterator it(X, i); it; ++it)
+        sum += it.value() * it.value();
+
+    return sum;
+}
+
+} // namespace detail
+
+inline
+LinearSVM::LinearSVM(double C,
+                     LinearSVMOptions options)
+    : C_(C),
+      options_(options)
+{
+    if (C_ <= 0.0)
+        throw std::invalid_argument("LinearSVM: C must be > 0.");
+}
+
+inline SolverReport
+LinearSVM::fit(const FeatureMatrix& X,
+               const Eigen::VectorXd& labels)
+{
+    return solve(X, labels);
+}
+
+inline SolverReport
+LinearSVM::fit(const SparseFeatureMatrix& X,
+               const Eigen::VectorXd& labels)
+{
+    return solve(X, labels);
+}
+
+template <typename MatrixT>
+inline SolverReport
+LinearSVM::solve(const MatrixT& X,
+                 const Eigen::VectorXd& labels)
+{
+    constexpr double inf = std::numeric_limits<double>::infinity();
+
+    if (labels.size() != X.rows())
+        throw std::invalid_argument("LinearSVM::fit: X and labels must have the same length.");
+
+    const std::size_t n = static_cast<std::size_t>(X.rows());
+    const double B = options_.bias_scale;
+
+    const bool hinge = options_.loss == LinearSVMLoss::hinge;
+    const double U = hinge ? C_ : inf;
+    const double D = hinge ? 0.0 : 0.5 / C_;
+
+    alpha_ = Eigen::VectorXd::Zero(X.rows());
+    w_ = Eigen::VectorXd::Zero(X.cols());
+    double w_bias = 0.0;  // weight of the constant feature B
+
+    Eigen::VectorXd QD(X.rows());
+    for (Eigen::Index i = 0; i < X.rows(); ++i)
+        QD(i) = detail::row_squared_norm(X, i) + B * B + D;
+
+    std::vector<std::size_t> active(n);
+    std::iota(active.begin(), active.end(), 0);
+
+    std::mt19937 rng(options_.seed);
+
+    // Projected-gradient bounds of the previous epoch, used for shrinking.
+    double PGmax_old = inf;
+    double PGmin_old = -inf;
+
+    SolverReport report;
+    report.min_active = n;
+
+    while (report.iterations < options_.max_epochs)
+    {
+        std::shuffle(active.begin(), active.end(), rng);
+
+        double PGmax = -inf;
+        double PGmin = inf;
+
+        for (std::size_t k = 0; k < active.size(); )
+        {
+            const auto i = static_cast<Eigen::Index>(active[k]);
+            const double yi = labels(i);
+            double& ai = alpha_(i);
+
+            const double G = yi * (detail::row_dot(X, i, w_) + w_bias * B) - 1.0 + D * ai;
+
+            double PG = 0.0;
+
+            if (ai == 0.0)
+            {
+                if (G > PGmax_old)
+                {
+                    active[k] = active.back();
+                    active.pop_back();
+                    continue;
+                }
+                PG = std::min(G, 0.0);
+            }
+            else if (ai == U)
+            {
+                if (G < PGmin_old)
+                {
+                    active[k] = active.back();
+                    active.pop_back();
+                    continue;
+                }
+                PG = std::max(G, 0.0);
+            }
+            else
+            {
+                PG = G;
+            }
+
+            PGmax = std::max(PGmax, PG);
+            PGmin = std::min(PGmin, PG);
+
+            if (std::abs(PG) > 1e-12)
+            {
+                const double a_old = ai;
+                ai = std::min(std::max(a_old - G / QD(i), 0.0), U);
+
+                const double delta = (ai - a_old) * yi;
+                detail::row_axpy(X, i, delta, w_);
+                w_bias += delta * B;
+            }
+
+            ++k;
+        }
+
+        ++report.iterations;
+        report.min_active = std::min(report.min_active, active.size());
+        report.kkt_gap = PGmax - PGmin;
+
+        if (report.kkt_gap <= options_.tolerance)
+        {
+            if (active.size() == n)
+            {
+                report.converged = true;
+                break;
+            }
+
+            // Optimal on the shrunk problem only: re-check on all of it.
+            active.resize(n);
+            std::iota(active.begin(), active.end(), 0);
+            PGmax_old = inf;
+            PGmin_old = -inf;
+            continue;
+        }
+
+        if (options_.shrinking)
+        {
+            PGmax_old = PGmax > 0.0 ? PGmax : inf;
+            PGmin_old = PGmin < 0.0 ? PGmin : -inf;
+        }
+    }
+
+    bias_ = w_bias * B;
+
+    return report;
+}
+
+inline
+double LinearSVM::decision(const Vector& x) const
+{
+    const Eigen::Map<const Eigen::VectorXd> v(x.data(), w_.size());
+    return w_.dot(v) + bias_;
+}
+
+inline
+Eigen::VectorXd LinearSVM::decision_batch(const FeatureMatrix& X) const
+{
+    Eigen::VectorXd out = X * w_;
+    out.array() += bias_;
+    return out;
+}
+
+inline
+Eigen::VectorXd LinearSVM::decision_batch(const SparseFeatureMatrix& X) const
+{
+    Eigen::VectorXd out = X * w_;
+    out.array() += bias_;
+    return out;
+}
+
+inline
+int LinearSVM::predict(const Vector& x) const
+{
+    return decision(x) >= 0.0 ? +1 : -1;
+}
+
+inline const Eigen::VectorXd&
+LinearSVM::weights() const noexcept
+{
+    return w_;
+}
+
+inline double
+LinearSVM::bias() const noexcept
+{
+    return bias_;
+}
+
+inline const Eigen::VectorXd&
+LinearSVM::alpha() const noexcept
+{
+    return alpha_;
+}
+
+} // namespace mlpp::classifiers::kernel
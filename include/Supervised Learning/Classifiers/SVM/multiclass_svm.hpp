@@ -0,0 +1,187 @@
+// include/Supervised Learning/Classifiers/SVM/multiclass_svm.hpp
+#pragma once
+
+#include "SVM.hpp"
+#include "Kernel/subset_gram.hpp"
+
+#include <Eigen/Dense>
+#include <vector>
+#include <cstddef>
+
+namespace mlpp::classifiers::kernel
+{
+
+/**
+ * Decomposition of a K-class problem into binary SVMs.
+ */
+enum class MulticlassStrategy
+{
+    // K(K−1)/2 machines, one per class pair, combined by voting.
+    one_vs_one,
+
+    // K machines, class k against the rest, combined by arg max f_k.
+    one_vs_rest
+};
+
+/**
+ * Training configuration for MulticlassSVM.
+ */
+struct MulticlassSVMOptions
+{
+    MulticlassStrategy strategy = MulticlassStrategy::one_vs_one;
+
+    /**
+     * Settings shared by all binary sub-problems.
+     *
+     * threads also bounds how many sub-problems are solved at once.
+     */
+    SVMOptions svm;
+};
+
+/**
+ * Multiclass kernel SVM built from binary SMO sub-problems.
+ *
+ * All sub-problems are solved concurrently on a thread pool. With the
+ * default dense cache the Gram matrix of the full training set is
+ * computed once and shared read-only: each sub-problem reads its rows
+ * through a SubsetGram view instead of evaluating its own kernel
+ * matrix. A bounded cache (SVMOptions::cache_bytes) is split between
+ * the sub-problems running at the same time.
+ *
+ * After training, the support vectors of all machines are merged into
+ * one packed set S of size U and the coefficients into a U × M matrix
+ * A (zero where a vector is not used by a machine), so the M decision
+ * values of a block of queries Q come from one kernel block:
+ *
+ *   F = K(S, Q)ᵀ A + 1 bᵀ
+ *
+ * Predictions vote over a row of F; pairwise ties go to the class that
+ * appears first in classes(), as in LIBSVM.
+ *
+ * @tparam KernelT  Kernel evaluator, see BasicSVM.
+ */
+template <KernelEvaluator KernelT>
+class BasicMulticlassSVM
+{
+public:
+    /**
+     * @param data     Training samples
+     * @param labels   Class label of each sample (at least two classes)
+     * @param kernel   Kernel function
+     * @param C        Soft margin penalty, shared by all machines
+     * @param options  Training configuration
+     */
+    BasicMulticlassSVM(const std::vector<Vector>& data,
+                       std::vector<int> labels,
+                       KernelT kernel,
+                       double C,
+                       MulticlassSVMOptions options = {});
+
+    /**
+     * Train every binary machine and merge them into the voting model.
+     *
+     * @return One report per machine, in the order of decision_batch.
+     */
+    std::vector<SolverReport> fit();
+
+    /**
+     * Decision values of all machines for one query per row of Q.
+     *
+     * @return m × M matrix. One-vs-one machines are ordered (0,1),
+     *         (0,2), ..., (K−2,K−1) over classes(); one-vs-rest
+     *         machine k separates classes()[k] from the rest.
+     */
+    [[nodiscard]]
+    Eigen::MatrixXd decision_batch(const Eigen::MatrixXd& Q) const;
+
+    /**
+     * Predict the class label of x.
+     */
+    [[nodiscard]]
+    int predict(const Vector& x) const;
+
+    /**
+     * Predict the class label of every row of Q.
+     *
+     * Kernel values against the merged support set are computed once
+     * per query and shared by all machines.
+     */
+    [[nodiscard]]
+    std::vector<int> predict_batch(const Eigen::MatrixXd& Q) const;
+
+    // Distinct labels in ascending order.
+    [[nodiscard]]
+    const std::vector<int>& classes() const noexcept;
+
+    // Number of binary machines M.
+    [[nodiscard]]
+    std::size_t n_models() const noexcept;
+
+    // Union of the support vectors of all machines.
+    [[nodiscard]]
+    const BasicSupportVectorSet<KernelT>& support_vectors() const noexcept;
+
+    // U × M coefficients α_i y_i, one column per machine.
+    [[nodiscard]]
+    const Eigen::MatrixXd& coefficients() const noexcept;
+
+    // Offsets b, one per machine.
+    [[nodiscard]]
+    const Eigen::VectorXd& biases() const noexcept;
+
+private:
+    /**
+     * One binary sub-problem: samples and their ±1 labels.
+     */
+    struct Problem
+    {
+        std::vector<std::size_t> index;     // sample indices
+        Eigen::VectorXd y;
+    };
+
+    [[nodiscard]]
+    std::vector<Problem> make_problems() const;
+
+    /**
+     * Merge the solutions into the packed support set and A.
+     */
+    void finalize(const std::vector<Problem>& problems,
+                  const std::vector<Eigen::VectorXd>& alphas,
+                  const std::vector<double>& biases);
+
+    /**
+     * Fᵀ for a block of queries: column c holds the M decision values
+     * of row c of Qb, contiguous for voting.
+     */
+    void decision_block(const Eigen::MatrixXd& Qb,
+                        Eigen::MatrixXd& Ft) const;
+
+    // Index into classes() of the winner for M decision values.
+    [[nodiscard]]
+    std::size_t vote(const double* decisions) const;
+
+private:
+    static constexpr Eigen::Index batch_block = 1024;
+
+    const std::vector<Vector>& data_;
+    std::vector<int> labels_;
+    std::vector<int> classes_;
+    std::vector<std::size_t> class_of_;   // sample -> index into classes_
+
+    KernelT kernel_;
+    double C_;
+    MulticlassSVMOptions options_;
+
+    BasicSupportVectorSet<KernelT> support_;
+    Eigen::MatrixXd coef_;
+    Eigen::VectorXd bias_;
+};
+
+/**
+ * Runtime-polymorphic multiclass SVM.
+ */
+using MulticlassSVM = BasicMulticlassSVM<KernelFunction>;
+
+} // namespace mlpp::classifiers::kernel
+
+#include "multiclass_svm.inl"
@@ -0,0 +1,334 @@
+// include/Supervised Learning/Classifiers/SVM/multiclass_svm.inl
+#pragma once
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "multiclass_svm.hpp"
+#include "Parallel/thread_pool.hpp"
+
+namespace mlpp::classifiers::kernel
+{
+
+template <KernelEvaluator KernelT>
+inline
+BasicMulticlassSVM<KernelT>::BasicMulticlassSVM(const std::vector<Vector>& data,
+                                                std::vector<int> labels,
+                                                KernelT kernel,
+                                                double C,
+                                                MulticlassSVMOptions options)
+    : data_(data),
+      labels_(std::move(labels)),
+      kernel_(std::move(kernel)),
+      C_(C),
+      options_(options)
+{
+    if (labels_.size() != data_.size())
+        throw std::invalid_argument(
+            "MulticlassSVM: data and labels must have the same length.");
+
+    classes_ = labels_;
+    std::sort(classes_.begin(), classes_.end());
+    classes_.erase(std::unique(classes_.begin(), classes_.end()), classes_.end());
+
+    if (classes_.size() < 2)
+        throw std::invalid_argument("MulticlassSVM: need at least two classes.");
+
+    class_of_.resize(labels_.size());
+    for (std::size_t i = 0; i < labels_.size(); ++i)
+    {
+        class_of_[i] = static_cast<std::size_t>(
+            std::lower_bound(classes_.begin(), classes_.end(), labels_[i])
+            - classes_.begin());
+    }
+}
+
+template <KernelEvaluator KernelT>
+inline
+auto BasicMulticlassSVM<KernelT>::make_problems() const -> std::vector<Problem>
+{
+    const std::size_t K = classes_.size();
+    const std::size_t n = data_.size();
+
+    std::vector<Problem> problems;
+
+    if (options_.strategy == MulticlassStrategy::one_vs_rest)
+    {
+        problems.resize(K);
+
+        for (std::size_t k = 0; k < K; ++k)
+        {
+            Problem& p = problems[k];
+            p.index.resize(n);
+            p.y.resize(static_cast<Eigen::Index>(n));
+
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                p.index[i] = i;
+                p.y(i) = class_of_[i] == k ? +1.0 : -1.0;
+            }
+        }
+
+        return problems;
+    }
+
+    problems.reserve(K * (K - 1) / 2);
+
+    for (std::size_t a = 0; a < K; ++a)
+    {
+        for (std::size_t b = a + 1; b < K; ++b)
+        {
+            Problem& p = problems.emplace_back();
+
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                if (class_of_[i] == a || class_of_[i] == b)
+                    p.index.push_back(i);
+            }
+
+            p.y.resize(static_cast<Eigen::Index>(p.index.size()));
+            for (std::size_t t = 0; t < p.index.size(); ++t)
+                p.y(t) = class_of_[p.index[t]] == a ? +1.0 : -1.0;
+        }
+    }
+
+    return problems;
+}
+
+template <KernelEvaluator KernelT>
+inline std::vector<SolverReport>
+BasicMulticlassSVM<KernelT>::fit()
+{
+    const std::vector<Problem> problems = make_problems();
+    const std::size_t M = problems.size();
+
+    std::vector<Eigen::VectorXd> alphas(M);
+    std::vector<double> biases(M, 0.0);
+    std::vector<SolverReport> reports(M);
+
+    const std::size_t threads = parallel::resolve_threads(options_.svm.threads);
+    parallel::ThreadPool pool(std::min(threads, M) - 1);
+
+    if (options_.svm.cache_bytes == 0)
+    {
+        // One Gram matrix for all machines; read-only once precomputed.
+        BasicKernelCache<KernelT> cache(data_, kernel_);
+        cache.precompute(threads);
+
+        pool.parallel_for(M, [&](std::size_t m)
+        {
+            const Problem& p = problems[m];
+            const SubsetGram gram(cache, p.index);
+
+            alphas[m] = Eigen::VectorXd::Zero(p.y.size());
+
+            SMOSolver solver(gram, p.y, C_, options_.svm.solver);
+            reports[m] = solver.solve(alphas[m], biases[m]);
+        });
+    }
+    else
+    {
+        // LRU caches mutate on every access; give each running
+        // sub-problem its own share of the budget.
+        const std::size_t budget = options_.svm.cache_bytes / (pool.size() + 1);
+
+        pool.parallel_for(M, [&](std::size_t m)
+        {
+            const Problem& p = problems[m];
+
+            std::vector<Vector> subset;
+            subset.reserve(p.index.size());
+            for (std::size_t i : p.index)
+                subset.push_back(data_[i]);
+
+            const BasicKernelCache<KernelT> cache(subset, kernel_, budget);
+
+            alphas[m] = Eigen::VectorXd::Zero(p.y.size());
+
+            SMOSolver solver(cache, p.y, C_, options_.svm.solver);
+            reports[m] = solver.solve(alphas[m], biases[m]);
+        });
+    }
+
+    finalize(problems, alphas, biases);
+
+    return reports;
+}
+
+template <KernelEvaluator KernelT>
+inline
+void BasicMulticlassSVM<KernelT>::finalize(const std::vector<Problem>& problems,
+                                           const std::vector<Eigen::VectorXd>& alphas,
+                                           const std::vector<double>& biases)
+{
+    constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    const std::size_t n = data_.size();
+    const std::size_t M = problems.size();
+    const std::size_t dim = data_.empty() ? 0 : data_.front().size();
+
+    // Position of each sample in the merged support set, or npos.
+    std::vector<std::size_t> position(n, npos);
+    std::size_t U = 0;
+
+    for (std::size_t m = 0; m < M; ++m)
+    {
+        for (std::size_t t = 0; t < problems[m].index.size(); ++t)
+        {
+            const std::size_t i = problems[m].index[t];
+            if (alphas[m](t) > 0.0 && position[i] == npos)
+                position[i] = U++;
+        }
+    }
+
+    typename BasicSupportVectorSet<KernelT>::RowMatrix vectors(U, dim);
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        if (position[i] != npos)
+            std::copy(data_[i].begin(), data_[i].end(), vectors.row(position[i]).data());
+    }
+
+    coef_ = Eigen::MatrixXd::Zero(static_cast<Eigen::Index>(U),
+                                  static_cast<Eigen::Index>(M));
+    bias_.resize(static_cast<Eigen::Index>(M));
+
+    for (std::size_t m = 0; m < M; ++m)
+    {
+        const Problem& p = problems[m];
+
+        for (std::size_t t = 0; t < p.index.size(); ++t)
+        {
+            if (alphas[m](t) > 0.0)
+                coef_(position[p.index[t]], m) = alphas[m](t) * p.y(t);
+        }
+
+        bias_(m) = biases[m];
+    }
+
+    support_ = BasicSupportVectorSet<KernelT>(std::move(vectors), kernel_);
+}
+
+template <KernelEvaluator KernelT>
+inline
+void BasicMulticlassSVM<KernelT>::decision_block(const Eigen::MatrixXd& Qb,
+                                                 Eigen::MatrixXd& Ft) const
+{
+    Eigen::MatrixXd K;
+    support_.kernel_block(Qb, K);
+
+    Ft.noalias() = coef_.transpose() * K;
+    Ft.colwise() += bias_;
+}
+
+template <KernelEvaluator KernelT>
+inline std::size_t
+BasicMulticlassSVM<KernelT>::vote(const double* decisions) const
+{
+    const std::size_t K = classes_.size();
+
+    if (options_.strategy == MulticlassStrategy::one_vs_rest)
+        return static_cast<std::size_t>(std::max_element(decisions, decisions + K) - decisions);
+
+    std::vector<std::size_t> votes(K, 0);
+    std::size_t m = 0;
+
+    for (std::size_t a = 0; a < K; ++a)
+    {
+        for (std::size_t b = a + 1; b < K; ++b)
+            ++votes[decisions[m++] > 0.0 ? a : b];
+    }
+
+    return static_cast<std::size_t>(std::max_element(votes.begin(), votes.end()) - votes.begin());
+}
+
+template <KernelEvaluator KernelT>
+inline
+Eigen::MatrixXd BasicMulticlassSVM<KernelT>::decision_batch(const Eigen::MatrixXd& Q) const
+{
+    const Eigen::Index m = Q.rows();
+
+    Eigen::MatrixXd F(m, coef_.cols());
+    Eigen::MatrixXd Ft;
+
+    for (Eigen::Index start = 0; start < m; start += batch_block)
+    {
+        const Eigen::Index len = std::min(batch_block, m - start);
+
+        decision_block(Q.middleRows(start, len), Ft);
+        F.middleRows(start, len) = Ft.transpose();
+    }
+
+    return F;
+}
+
+template <KernelEvaluator KernelT>
+inline
+int BasicMulticlassSVM<KernelT>::predict(const Vector& x) const
+{
+    Eigen::VectorXd k;
+    support_.kernel_row(x, k);
+
+    const Eigen::VectorXd f = coef_.transpose() * k + bias_;
+
+    return classes_[vote(f.data())];
+}
+
+template <KernelEvaluator KernelT>
+inline
+std::vector<int> BasicMulticlassSVM<KernelT>::predict_batch(const Eigen::MatrixXd& Q) const
+{
+    const Eigen::Index m = Q.rows();
+
+    std::vector<int> out(static_cast<std::size_t>(m));
+    Eigen::MatrixXd Ft;
+
+    for (Eigen::Index start = 0; start < m; start += batch_block)
+    {
+        const Eigen::Index len = std::min(batch_block, m - start);
+
+        decision_block(Q.middleRows(start, len), Ft);
+
+        for (Eigen::Index c = 0; c < len; ++c)
+            out[start + c] = classes_[vote(Ft.col(c).data())];
+    }
+
+    return out;
+}
+
+template <KernelEvaluator KernelT>
+inline const std::vector<int>&
+BasicMulticlassSVM<KernelT>::classes() const noexcept
+{
+    return classes_;
+}
+
+template <KernelEvaluator KernelT>
+inline std::size_t
+BasicMulticlassSVM<KernelT>::n_models() const noexcept
+{
+    return static_cast<std::size_t>(bias_.size());
+}
+
+template <KernelEvaluator KernelT>
+inline const BasicSupportVectorSet<KernelT>&
+BasicMulticlassSVM<KernelT>::support_vectors() const noexcept
+{
+    return support_;
+}
+
+template <KernelEvaluator KernelT>
+inline const Eigen::MatrixXd&
+BasicMulticlassSVM<KernelT>::coefficients() const noexcept
+{
+    return coef_;
+}
+
+template <KernelEvaluator KernelT>
+inline const Eigen::VectorXd&
+BasicMulticlassSVM<KernelT>::biases() const noexcept
+{
+    return bias_;
+}
+
+} // namespace mlpp::classifiers::kernel
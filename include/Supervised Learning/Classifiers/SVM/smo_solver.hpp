@@ -0,0 +1,160 @@
+// include/Supervised Learning/Classifiers/SVM/smo_solver.hpp
+#pragma once
+
+#include "Kernel/kernel_cache.hpp"
+
+#include <Eigen/Dense>
+#include <vector>
+#include <cstddef>
+
+namespace mlpp::classifiers::kernel
+{
+
+/**
+ * Configuration for SMOSolver.
+ */
+struct SMOOptions
+{
+    // Stop once the maximal KKT violation m(α) − M(α) drops below this.
+    double tolerance = 1e-3;
+
+    // Hard cap on the number of two-variable updates.
+    std::size_t max_iterations = 10'000'000;
+
+    // Temporarily drop variables pinned at a bound from the active set.
+    bool shrinking = true;
+};
+
+/**
+ * Outcome of a solver run.
+ */
+struct SolverReport
+{
+    std::size_t iterations = 0;
+
+    // Final maximal KKT violation m(α) − M(α).
+    double kkt_gap = 0.0;
+
+    // True if kkt_gap < tolerance before max_iterations was reached.
+    bool converged = false;
+
+    // Smallest active set size reached by shrinking (n without it).
+    std::size_t min_active = 0;
+};
+
+/**
+ * Sequential Minimal Optimization with second-order working set
+ * selection (WSS2, Fan, Chen & Lin 2005).
+ *
+ * Solves the SVM dual in its minimisation form
+ *
+ *   min_α  f(α) = 1/2 αᵀ Q α − eᵀ α,   Q_ij = y_i y_j K(x_i, x_j)
+ *
+ *   subject to  0 ≤ α_i ≤ C,  yᵀ α = 0.
+ *
+ * The gradient G = Q α − e is kept up to date, so every iteration
+ * costs O(n) plus at most two kernel rows:
+ *
+ *   i = argmax { −y_t G_t : t ∈ I_up(α) }
+ *   j = argmin { −b_t² / a_t : t ∈ I_low(α), −y_t G_t < −y_i G_i }
+ *
+ * with b_t = −y_i G_i + y_t G_t and a_t = K_ii + K_tt − 2 K_it.
+ * The run stops when m(α) − M(α) < tolerance.
+ *
+ * With shrinking enabled, variables that sit at a bound and are
+ * unlikely to move are periodically removed from the active set, so
+ * selection, gradient updates and kernel rows only touch active
+ * entries. The gradient of removed variables is reconstructed from
+ *
+ *   Ḡ_t = C Σ_{α_s = C} Q_ts
+ *
+ * and the free variables before optimality is checked on the full
+ * problem (LIBSVM, Chang & Lin 2011, §5.1).
+ *
+ * @tparam Gram  Kernel matrix access with size(), operator()(i, j),
+ *               row(i) and row(i, subset), as in BasicKernelCache.
+ *               Rows may hold float entries; G and Ḡ are always
+ *               accumulated in double.
+ */
+template <typename Gram>
+class SMOSolver
+{
+public:
+    /**
+     * @param gram     Kernel cache over the training samples
+     * @param labels   Class labels in {−1, +1}
+     * @param C        Box constraint
+     * @param options  Stopping criteria
+     */
+    SMOSolver(const Gram& gram,
+              const Eigen::VectorXd& labels,
+              double C,
+              SMOOptions options = {});
+
+    /**
+     * Run the optimisation.
+     *
+     * @param alpha  Dual variables; must be feasible on entry
+     *               (e.g. all zeros) and hold the solution on return.
+     * @param bias   Receives b of f(x) = Σ α_i y_i K(x_i, x) + b.
+     */
+    SolverReport solve(Eigen::VectorXd& alpha,
+                       double& bias);
+
+private:
+    /**
+     * Select the working pair (i, j).
+     *
+     * Returns false if no pair violates the KKT conditions by more
+     * than the tolerance. gap receives m(α) − M(α), or 0 when
+     * I_up or I_low is empty (a single class).
+     */
+    bool select_working_set(const Eigen::VectorXd& alpha,
+                            std::size_t& i,
+                            std::size_t& j,
+                            double& gap) const;
+
+    /**
+     * Offset ρ = −b, averaged over free variables when there are any,
+     * else the midpoint of the bounds, or the one finite bound.
+     */
+    double compute_rho(const Eigen::VectorXd& alpha) const;
+
+    /**
+     * Remove bounded variables that cannot enter the working set.
+     */
+    void do_shrinking(const Eigen::VectorXd& alpha);
+
+    /**
+     * Restore the full active set and recompute the gradient of
+     * every variable that was shrunk away.
+     */
+    void reconstruct_gradient(const Eigen::VectorXd& alpha);
+
+    bool be_shrunk(const Eigen::VectorXd& alpha,
+                   std::size_t t,
+                   double Gmax1,
+                   double Gmax2) const noexcept;
+
+    bool in_up(const Eigen::VectorXd& alpha, std::size_t t) const noexcept;
+    bool in_low(const Eigen::VectorXd& alpha, std::size_t t) const noexcept;
+
+private:
+    static constexpr double tau = 1e-12;
+
+    const Gram& gram_;
+    const Eigen::VectorXd& y_;
+    double C_;
+    SMOOptions options_;
+
+    Eigen::VectorXd G_;      // gradient of f
+    Eigen::VectorXd G_bar_;  // gradient contribution of α_s = C
+    Eigen::VectorXd QD_;     // diagonal K_tt
+
+    std::vector<std::size_t> active_;
+    bool unshrink_ = false;
+};
+
+} // namespace mlpp::classifiers::kernel
+
+#include "smo_solver.inl"
@@ -0,0 +1,449 @@
+// include/Supervised Learning/Classifiers/SVM/smo_solver.inl
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "smo_solver.hpp"
+
+namespace mlpp::classifiers::kernel
+{
+
+template <typename Gram>
+inline
+SMOSolver<Gram>::SMOSolver(const Gram& gram,
+                           const Eigen::VectorXd& labels,
+                           double C,
+                           SMOOptions options)
+    : gram_(gram),
+      y_(labels),
+      C_(C),
+      options_(options)
+{
+}
+
+template <typename Gram>
+inline bool
+SMOSolver<Gram>::in_up(const Eigen::VectorXd& alpha,
+                       std::size_t t) const noexcept
+{
+    return y_(t) > 0.0 ? alpha(t) < C_ : alpha(t) > 0.0;
+}
+
+template <typename Gram>
+inline bool
+SMOSolver<Gram>::in_low(const Eigen::VectorXd& alpha,
+                        std::size_t t) const noexcept
+{
+    return y_(t) > 0.0 ? alpha(t) > 0.0 : alpha(t) < C_;
+}
+
+template <typename Gram>
+inline bool
+SMOSolver<Gram>::select_working_set(const Eigen::VectorXd& alpha,
+                                    std::size_t& i,
+                                    std::size_t& j,
+                                    double& gap) const
+{
+    const std::size_t n = gram_.size();
+    constexpr double inf = std::numeric_limits<double>::infinity();
+
+    // i: maximal violator in I_up
+    double Gmax = -inf;
+    i = n;
+
+    for (std::size_t t : active_)
+    {
+        if (!in_up(alpha, t))
+            continue;
+
+        const double v = -y_(t) * G_(t);
+        if (v >= Gmax)
+        {
+            Gmax = v;
+            i = t;
+        }
+    }
+
+    // j: largest second-order decrease of f among I_low
+    double Gmax2 = -inf;
+    double obj_min = inf;
+    j = n;
+
+    const auto* Ki = (i < n) ? gram_.row(i, active_) : nullptr;
+
+    for (std::size_t t : active_)
+    {
+        if (!in_low(alpha, t))
+            continue;
+
+        const double v = y_(t) * G_(t);
+        Gmax2 = std::max(Gmax2, v);
+
+        const double b = Gmax + v;
+        if (Ki == nullptr || b <= 0.0)
+            continue;
+
+        double a = QD_(i) + QD_(t) - 2.0 * Ki[t];
+        if (a <= 0.0)
+            a = tau;
+
+        const double obj = -(b * b) / a;
+        if (obj <= obj_min)
+        {
+            obj_min = obj;
+            j = t;
+        }
+    }
+
+    // An empty I_up or I_low leaves no feasible direction: α is optimal.
+    gap = (Gmax == -inf || Gmax2 == -inf) ? 0.0 : Gmax + Gmax2;
+
+    return gap >= options_.tolerance && i < n && j < n;
+}
+
+template <typename Gram>
+inline double
+SMOSolver<Gram>::compute_rho(const Eigen::VectorXd& alpha) const
+{
+    constexpr double inf = std::numeric_limits<double>::infinity();
+
+    double ub = inf;
+    double lb = -inf;
+    double sum_free = 0.0;
+    std::size_t n_free = 0;
+
+    for (std::size_t t : active_)
+    {
+        const double yG = y_(t) * G_(t);
+
+        if (alpha(t) >= C_)
+        {
+            if (y_(t) < 0.0) ub = std::min(ub, yG);
+            else             lb = std::max(lb, yG);
+        }
+        else if (alpha(t) <= 0.0)
+        {
+            if (y_(t) > 0.0) ub = std::min(ub, yG);
+            else             lb = std::max(lb, yG);
+        }
+        else
+        {
+            sum_free += yG;
+            ++n_free;
+        }
+    }
+
+    if (n_free > 0)
+        return sum_free / static_cast<double>(n_free);
+
+    // One side is empty when a single class is present: take the other
+    // bound, or 0 if there is neither.
+    if (std::isinf(ub) && std::isinf(lb))
+        return 0.0;
+    if (std::isinf(ub))
+        return lb;
+    if (std::isinf(lb))
+        return ub;
+
+    return 0.5 * (ub + lb);
+}
+
+template <typename Gram>
+inline bool
+SMOSolver<Gram>::be_shrunk(const Eigen::VectorXd& alpha,
+                           std::size_t t,
+                           double Gmax1,
+                           double Gmax2) const noexcept
+{
+    if (alpha(t) >= C_)
+        return y_(t) > 0.0 ? -G_(t) > Gmax1 : -G_(t) > Gmax2;
+
+    if (alpha(t) <= 0.0)
+        return y_(t) > 0.0 ? G_(t) > Gmax2 : G_(t) > Gmax1;
+
+    return false;
+}
+
+template <typename Gram>
+inline void
+SMOSolver<Gram>::do_shrinking(const Eigen::VectorXd& alpha)
+{
+    constexpr double inf = std::numeric_limits<double>::infinity();
+
+    double Gmax1 = -inf; // max { −y_t G_t : t ∈ I_up }
+    double Gmax2 = -inf; // max {  y_t G_t : t ∈ I_low }
+
+    for (std::size_t t : active_)
+    {
+        if (in_up(alpha, t))
+            Gmax1 = std::max(Gmax1, -y_(t) * G_(t));
+        if (in_low(alpha, t))
+            Gmax2 = std::max(Gmax2, y_(t) * G_(t));
+    }
+
+    // Close to the optimum: un-shrink once so that variables removed
+    // on a stale gradient get another chance.
+    if (!unshrink_ && Gmax1 + Gmax2 <= 10.0 * options_.tolerance)
+    {
+        unshrink_ = true;
+        reconstruct_gradient(alpha);
+    }
+
+    std::erase_if(active_, [&](std::size_t t)
+    {
+        return be_shrunk(alpha, t, Gmax1, Gmax2);
+    });
+}
+
+template <typename Gram>
+inline void
+SMOSolver<Gram>::reconstruct_gradient(const Eigen::VectorXd& alpha)
+{
+    const std::size_t n = gram_.size();
+
+    if (active_.size() == n)
+        return;
+
+    std::vector<bool> is_active(n, false);
+    for (std::size_t t : active_)
+        is_active[t] = true;
+
+    std::vector<std::size_t> inactive;
+    std::vector<std::size_t> free;
+    inactive.reserve(n - active_.size());
+
+    for (std::size_t t = 0; t < n; ++t)
+    {
+        if (!is_active[t])
+        {
+            inactive.push_back(t);
+            G_(t) = G_bar_(t) - 1.0;
+        }
+
+        if (alpha(t) > 0.0 && alpha(t) < C_)
+            free.push_back(t);
+    }
+
+    // G_t = Ḡ_t − 1 + Σ_{s free} α_s Q_ts. Fetch whichever side
+    // needs fewer (partial) rows.
+    if (free.size() <= inactive.size())
+    {
+        for (std::size_t s : free)
+        {
+            const auto* Ks = gram_.row(s, inactive);
+            const double c = alpha(s) * y_(s);
+
+            for (std::size_t t : inactive)
+                G_(t) += y_(t) * c * Ks[t];
+        }
+    }
+    else
+    {
+        for (std::size_t t : inactive)
+        {
+            const auto* Kt = gram_.row(t, free);
+
+            double sum = 0.0;
+            for (std::size_t s : free)
+                sum += alpha(s) * y_(s) * Kt[s];
+
+            G_(t) += y_(t) * sum;
+        }
+    }
+
+    active_.resize(n);
+    for (std::size_t t = 0; t < n; ++t)
+        active_[t] = t;
+}
+
+template <typename Gram>
+inline SolverReport
+SMOSolver<Gram>::solve(Eigen::VectorXd& alpha,
+                       double& bias)
+{
+    const std::size_t n = gram_.size();
+
+    QD_.resize(static_cast<Eigen::Index>(n));
+    for (std::size_t t = 0; t < n; ++t)
+        QD_(t) = gram_(t, t);
+
+    active_.resize(n);
+    for (std::size_t t = 0; t < n; ++t)
+        active_[t] = t;
+
+    unshrink_ = false;
+
+    // G = Q α − e,  Ḡ = C Σ_{α_s = C} Q_s
+    G_ = Eigen::VectorXd::Constant(static_cast<Eigen::Index>(n), -1.0);
+    G_bar_ = Eigen::VectorXd::Zero(static_cast<Eigen::Index>(n));
+
+    for (std::size_t s = 0; s < n; ++s)
+    {
+        if (alpha(s) == 0.0)
+            continue;
+
+        const auto* Ks = gram_.row(s);
+        const double c = alpha(s) * y_(s);
+
+        for (std::size_t t = 0; t < n; ++t)
+            G_(t) += y_(t) * c * Ks[t];
+
+        if (alpha(s) >= C_)
+        {
+            for (std::size_t t = 0; t < n; ++t)
+                G_bar_(t) += y_(t) * C_ * y_(s) * Ks[t];
+        }
+    }
+
+    SolverReport report;
+    report.min_active = n;
+
+    const std::size_t shrink_interval = std::min<std::size_t>(n, 1000);
+    std::size_t counter = shrink_interval;
+
+    while (report.iterations < options_.max_iterations)
+    {
+        if (options_.shrinking && --counter == 0)
+        {
+            counter = shrink_interval;
+            do_shrinking(alpha);
+            report.min_active = std::min(report.min_active, active_.size());
+        }
+
+        std::size_t i, j;
+
+        if (!select_working_set(alpha, i, j, report.kkt_gap))
+        {
+            if (active_.size() == n)
+            {
+                report.converged = report.kkt_gap < options_.tolerance;
+                break;
+            }
+
+            // Optimal on the shrunk problem only: re-check on all of it.
+            reconstruct_gradient(alpha);
+            counter = 1;
+
+            if (!select_working_set(alpha, i, j, report.kkt_gap))
+            {
+                report.converged = report.kkt_gap < options_.tolerance;
+                break;
+            }
+        }
+
+        ++report.iterations;
+
+        // Row i was fetched during selection; the cache keeps both
+        // of the two most recently used rows resident.
+        const auto* Ki = gram_.row(i, active_);
+        const auto* Kj = gram_.row(j, active_);
+
+        const double ai_old = alpha(i);
+        const double aj_old = alpha(j);
+
+        double a = QD_(i) + QD_(j) - 2.0 * Ki[j];
+        if (a <= 0.0)
+            a = tau;
+
+        double& ai = alpha(i);
+        double& aj = alpha(j);
+
+        if (y_(i) != y_(j))
+        {
+            const double delta = (-G_(i) - G_(j)) / a;
+            const double diff = ai - aj;
+
+            ai += delta;
+            aj += delta;
+
+            if (diff > 0.0)
+            {
+                if (aj < 0.0) { aj = 0.0; ai = diff; }
+            }
+            else
+            {
+                if (ai < 0.0) { ai = 0.0; aj = -diff; }
+            }
+
+            if (diff > 0.0)
+            {
+                if (ai > C_) { ai = C_; aj = C_ - diff; }
+            }
+            else
+            {
+                if (aj > C_) { aj = C_; ai = C_ + diff; }
+            }
+        }
+        else
+        {
+            const double delta = (G_(i) - G_(j)) / a;
+            const double sum = ai + aj;
+
+            ai -= delta;
+            aj += delta;
+
+            if (sum > C_)
+            {
+                if (ai > C_) { ai = C_; aj = sum - C_; }
+            }
+            else
+            {
+                if (aj < 0.0) { aj = 0.0; ai = sum; }
+            }
+
+            if (sum > C_)
+            {
+                if (aj > C_) { aj = C_; ai = sum - C_; }
+            }
+            else
+            {
+                if (ai < 0.0) { ai = 0.0; aj = sum; }
+            }
+        }
+
+        const double di = (ai - ai_old) * y_(i);
+        const double dj = (aj - aj_old) * y_(j);
+
+        for (std::size_t t : active_)
+            G_(t) += y_(t) * (di * Ki[t] + dj * Kj[t]);
+
+        if (!options_.shrinking)
+            continue;
+
+        // Keep Ḡ in sync when a variable enters or leaves the upper bound.
+        const auto update_G_bar = [&](std::size_t k, double a_old, double a_new)
+        {
+            const bool was_upper = a_old >= C_;
+            const bool is_upper = a_new >= C_;
+
+            if (was_upper == is_upper)
+                return;
+
+            const auto* Kk = gram_.row(k);
+            const double c = (is_upper ? C_ : -C_) * y_(k);
+
+            for (std::size_t t = 0; t < n; ++t)
+                G_bar_(t) += y_(t) * c * Kk[t];
+        };
+
+        update_G_bar(i, ai_old, ai);
+        update_G_bar(j, aj_old, aj);
+    }
+
+    if (!report.converged && report.iterations == options_.max_iterations)
+    {
+        reconstruct_gradient(alpha);
+
+        std::size_t i, j;
+        select_working_set(alpha, i, j, report.kkt_gap);
+        report.converged = report.kkt_gap < options_.tolerance;
+    }
+
+    bias = -compute_rho(alpha);
+
+    return report;
+}
+
+} // namespace mlpp::classifiers::kernel
@@ -0,0 +1,178 @@
+// include/Supervised Learning/Classifiers/SVM/support_vector_model.hpp
+#pragma once
+
+#include "Kernel/kernel.hpp"
+#include "Kernel/rkhs_kernels.hpp"
+#include "Kernel/static_kernels.hpp"
+
+#include <Eigen/Dense>
+#include <vector>
+#include <cstddef>
+
+namespace mlpp::classifiers::kernel
+{
+
+/**
+ * Packed set of support vectors together with their kernel.
+ *
+ * Stores the vectors in a contiguous row-major buffer and evaluates
+ * K(s_r, x) against all of them at once. Shared by the binary model
+ * and by multiclass models, whose sub-models draw on one common set.
+ *
+ * @tparam KernelT  Kernel evaluator, see BasicKernelCache.
+ */
+template <KernelEvaluator KernelT>
+class BasicSupportVectorSet
+{
+public:
+    using RowMatrix =
+        Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+    BasicSupportVectorSet() = default;
+
+    /**
+     * @param vectors  One support vector per row
+     * @param kernel   Kernel function
+     */
+    BasicSupportVectorSet(RowMatrix vectors,
+                          KernelT kernel);
+
+    /**
+     * Kernel values k_r = K(s_r, x) for every stored vector.
+     */
+    void kernel_row(const Vector& x,
+                    Eigen::VectorXd& k) const;
+
+    /**
+     * Kernel block K_rc = K(s_r, q_c) for the queries in the rows of Qb.
+     *
+     * For linear, polynomial and RBF kernels the block is obtained from
+     * a single matrix product S Qbᵀ; the RBF distances use
+     * ‖s − q‖² = ‖s‖² + ‖q‖² − 2 s·q. Any other kernel falls back to
+     * one evaluation per entry.
+     */
+    void kernel_block(const Eigen::MatrixXd& Qb,
+                      Eigen::MatrixXd& K) const;
+
+    // Number of stored vectors.
+    [[nodiscard]]
+    std::size_t size() const noexcept;
+
+    [[nodiscard]]
+    const RowMatrix& vectors() const noexcept;
+
+    [[nodiscard]]
+    const KernelT& kernel() const noexcept;
+
+private:
+    /**
+     * Dot-product kernels with a blocked form, and their parameters.
+     */
+    struct BlockForm
+    {
+        enum class Type { none, linear, polynomial, rbf };
+
+        Type type = Type::none;
+        double gamma = 0.0;
+        double coef0 = 0.0;
+        std::size_t degree = 0;
+    };
+
+    [[nodiscard]]
+    static BlockForm block_form(const KernelT& kernel) noexcept;
+
+private:
+    RowMatrix sv_;
+    Eigen::VectorXd sv_sq_norms_;
+    KernelT kernel_;
+};
+
+/**
+ * Compact inference model of a trained kernel SVM.
+ *
+ * Holds only the support vectors, packed into a contiguous row-major
+ * buffer, together with their coefficients c_i = α_i y_i:
+ *
+ *   f(x) = Σ_{i ∈ SV} c_i K(s_i, x) + b
+ *
+ * The model owns its data, so it stays valid after the training set
+ * (and the SVM that produced it) is gone.
+ *
+ * @tparam KernelT  Kernel evaluator, see BasicKernelCache.
+ */
+template <KernelEvaluator KernelT>
+class BasicSupportVectorModel
+{
+public:
+    using RowMatrix = typename BasicSupportVectorSet<KernelT>::RowMatrix;
+
+    BasicSupportVectorModel() = default;
+
+    /**
+     * @param support_vectors  One support vector per row
+     * @param coefficients     α_i y_i for each row
+     * @param bias             Offset b
+     * @param kernel           Kernel function
+     */
+    BasicSupportVectorModel(RowMatrix support_vectors,
+                            Eigen::VectorXd coefficients,
+                            double bias,
+                            KernelT kernel);
+
+    /**
+     * Evaluate the decision function f(x).
+     */
+    [[nodiscard]]
+    double decision(const Vector& x) const;
+
+    /**
+     * Evaluate the decision function for a batch of queries.
+     *
+     * The SV × query kernel block (see BasicSupportVectorSet::kernel_block)
+     * is reduced with the coefficient vector. Queries are processed in
+     * blocks of batch_block rows to bound the temporary.
+     *
+     * @param Q  One query per row (m × d)
+     * @return   f(q_r) for every row r
+     */
+    [[nodiscard]]
+    Eigen::VectorXd decision_batch(const Eigen::MatrixXd& Q) const;
+
+    /**
+     * Predict class label (+1 or -1).
+     */
+    [[nodiscard]]
+    int predict(const Vector& x) const;
+
+    // Number of support vectors.
+    [[nodiscard]]
+    std::size_t size() const noexcept;
+
+    [[nodiscard]]
+    const RowMatrix& support_vectors() const noexcept;
+
+    [[nodiscard]]
+    const Eigen::VectorXd& coefficients() const noexcept;
+
+    [[nodiscard]]
+    double bias() const noexcept;
+
+    [[nodiscard]]
+    const KernelT& kernel() const noexcept;
+
+private:
+    static constexpr Eigen::Index batch_block = 1024;
+
+    BasicSupportVectorSet<KernelT> set_;
+    Eigen::VectorXd coef_;
+    double bias_ = 0.0;
+};
+
+/**
+ * Runtime-polymorphic support-vector model.
+ */
+using SupportVectorModel = BasicSupportVectorModel<KernelFunction>;
+
+} // namespace mlpp::classifiers::kernel
+
+#include "support_vector_model.inl"
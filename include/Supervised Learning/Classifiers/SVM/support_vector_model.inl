@@ -0,0 +1,263 @@
+// include/Supervised Learning/Classifiers/SVM/support_vector_model.inl
+#pragma once
+
+#include <algorithm>
+#include <type_traits>
+
+#include "support_vector_model.hpp"
+#include "Kernel/simd_kernels.hpp"
+
+namespace mlpp::classifiers::kernel
+{
+
+template <KernelEvaluator KernelT>
+inline
+BasicSupportVectorSet<KernelT>::BasicSupportVectorSet(RowMatrix vectors,
+                                                      KernelT kernel)
+    : sv_(std::move(vectors)),
+      kernel_(std::move(kernel))
+{
+    sv_sq_norms_ = sv_.rowwise().squaredNorm();
+}
+
+template <KernelEvaluator KernelT>
+inline
+typename BasicSupportVectorSet<KernelT>::BlockForm
+BasicSupportVectorSet<KernelT>::block_form([[maybe_unused]] const KernelT& kernel) noexcept
+{
+    using Type = typename BlockForm::Type;
+
+    if constexpr (std::is_same_v<KernelT, KernelFunction>)
+    {
+        if (kernel.template target<LinearKernel>())
+            return { Type::linear };
+
+        if (const auto* poly = kernel.template target<PolynomialKernel>())
+            return { Type::polynomial, poly->gamma(), poly->coef0(), poly->degree() };
+
+        if (const auto* rbf = kernel.template target<RBFKernel>())
+            return { Type::rbf, rbf->gamma() };
+    }
+    else if constexpr (std::is_same_v<KernelT, static_kernel::Linear>)
+    {
+        return { Type::linear };
+    }
+    else if constexpr (std::is_same_v<KernelT, static_kernel::Polynomial>)
+    {
+        return { Type::polynomial, kernel.gamma, kernel.coef0, kernel.degree };
+    }
+    else if constexpr (std::is_same_v<KernelT, static_kernel::RBF>)
+    {
+        return { Type::rbf, kernel.gamma };
+    }
+
+    return {};
+}
+
+template <KernelEvaluator KernelT>
+inline
+void BasicSupportVectorSet<KernelT>::kernel_row(const Vector& x,
+                                                Eigen::VectorXd& k) const
+{
+    using Type = typename BlockForm::Type;
+
+    const std::size_t count = size();
+    const std::size_t dim = static_cast<std::size_t>(sv_.cols());
+    const BlockForm form = block_form(kernel_);
+
+    k.resize(static_cast<Eigen::Index>(count));
+
+    if (form.type == Type::none)
+    {
+        for (std::size_t r = 0; r < count; ++r)
+            k(r) = kernel_.evaluate(sv_.row(r).data(), x.data(), dim);
+
+        return;
+    }
+
+    // One query against all packed support vectors at once.
+    if (form.type == Type::rbf)
+    {
+        simd::squared_distance_many(x.data(), sv_.data(), count, dim, k.data());
+        k = (-form.gamma * k.array()).exp().matrix();
+    }
+    else
+    {
+        simd::dot_many(x.data(), sv_.data(), count, dim, k.data());
+
+        if (form.type == Type::polynomial)
+        {
+            k = k.unaryExpr([&](double d)
+            {
+                return simd::ipow(form.gamma * d + form.coef0, form.degree);
+            });
+        }
+    }
+}
+
+template <KernelEvaluator KernelT>
+inline
+void BasicSupportVectorSet<KernelT>::kernel_block(const Eigen::MatrixXd& Qb,
+                                                  Eigen::MatrixXd& K) const
+{
+    using Type = typename BlockForm::Type;
+
+    const BlockForm form = block_form(kernel_);
+
+    switch (form.type)
+    {
+    case Type::linear:
+        K.noalias() = sv_ * Qb.transpose();
+        return;
+
+    case Type::polynomial:
+        K.noalias() = sv_ * Qb.transpose();
+        K = K.unaryExpr([&](double d)
+        {
+            return simd::ipow(form.gamma * d + form.coef0, form.degree);
+        });
+        return;
+
+    case Type::rbf:
+    {
+        K.noalias() = sv_ * Qb.transpose();
+
+        const Eigen::RowVectorXd q_sq = Qb.rowwise().squaredNorm().transpose();
+
+        // ‖s‖² + ‖q‖² − 2 s·q, clamped against cancellation below zero
+        K = ((-2.0 * K).colwise() + sv_sq_norms_).rowwise() + q_sq;
+        K = (-form.gamma * K.array().max(0.0)).exp().matrix();
+        return;
+    }
+
+    case Type::none:
+        break;
+    }
+
+    const std::size_t dim = static_cast<std::size_t>(sv_.cols());
+    K.resize(sv_.rows(), Qb.rows());
+
+    Vector q(dim);
+    for (Eigen::Index c = 0; c < Qb.rows(); ++c)
+    {
+        for (std::size_t k = 0; k < dim; ++k)
+            q[k] = Qb(c, static_cast<Eigen::Index>(k));
+
+        for (Eigen::Index r = 0; r < sv_.rows(); ++r)
+            K(r, c) = kernel_.evaluate(sv_.row(r).data(), q.data(), dim);
+    }
+}
+
+template <KernelEvaluator KernelT>
+inline std::size_t
+BasicSupportVectorSet<KernelT>::size() const noexcept
+{
+    return static_cast<std::size_t>(sv_.rows());
+}
+
+template <KernelEvaluator KernelT>
+inline const typename BasicSupportVectorSet<KernelT>::RowMatrix&
+BasicSupportVectorSet<KernelT>::vectors() const noexcept
+{
+    return sv_;
+}
+
+template <KernelEvaluator KernelT>
+inline const KernelT&
+BasicSupportVectorSet<KernelT>::kernel() const noexcept
+{
+    return kernel_;
+}
+
+template <KernelEvaluator KernelT>
+inline
+BasicSupportVectorModel<KernelT>::BasicSupportVectorModel(RowMatrix support_vectors,
+                                                          Eigen::VectorXd coefficients,
+                                                          double bias,
+                                                          KernelT kernel)
+    : set_(std::move(support_vectors), std::move(kernel)),
+      coef_(std::move(coefficients)),
+      bias_(bias)
+{
+}
+
+template <KernelEvaluator KernelT>
+inline
+double BasicSupportVectorModel<KernelT>::decision(const Vector& x) const
+{
+    if (set_.size() == 0)
+        return bias_;
+
+    Eigen::VectorXd k;
+    set_.kernel_row(x, k);
+
+    return bias_ + coef_.dot(k);
+}
+
+template <KernelEvaluator KernelT>
+inline
+Eigen::VectorXd BasicSupportVectorModel<KernelT>::decision_batch(const Eigen::MatrixXd& Q) const
+{
+    const Eigen::Index m = Q.rows();
+
+    Eigen::VectorXd out = Eigen::VectorXd::Constant(m, bias_);
+
+    if (set_.size() == 0)
+        return out;
+
+    Eigen::MatrixXd K;
+
+    for (Eigen::Index start = 0; start < m; start += batch_block)
+    {
+        const Eigen::Index len = std::min(batch_block, m - start);
+
+        set_.kernel_block(Q.middleRows(start, len), K);
+        out.segment(start, len).noalias() += K.transpose() * coef_;
+    }
+
+    return out;
+}
+
+template <KernelEvaluator KernelT>
+inline
+int BasicSupportVectorModel<KernelT>::predict(const Vector& x) const
+{
+    return decision(x) >= 0.0 ? +1 : -1;
+}
+
+template <KernelEvaluator KernelT>
+inline std::size_t
+BasicSupportVectorModel<KernelT>::size() const noexcept
+{
+    return set_.size();
+}
+
+template <KernelEvaluator KernelT>
+inline const typename BasicSupportVectorModel<KernelT>::RowMatrix&
+BasicSupportVectorModel<KernelT>::support_vectors() const noexcept
+{
+    return set_.vectors();
+}
+
+template <KernelEvaluator KernelT>
+inline const Eigen::VectorXd&
+BasicSupportVectorModel<KernelT>::coefficients() const noexcept
+{
+    return coef_;
+}
+
+template <KernelEvaluator KernelT>
+inline double
+BasicSupportVectorModel<KernelT>::bias() const noexcept
+{
+    return bias_;
+}
+
+template <KernelEvaluator KernelT>
+inline const KernelT&
+BasicSupportVectorModel<KernelT>::kernel() const noexcept
+{
+    return set_.kernel();
+}
+
+} // namespace mlpp::classifiers::kernel
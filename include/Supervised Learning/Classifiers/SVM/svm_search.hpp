@@ -0,0 +1,161 @@
+// include/Supervised Learning/Classifiers/SVM/svm_search.hpp
+#pragma once
+
+#include "smo_solver.hpp"
+#include "Kernel/kernel.hpp"
+#include "Model Validation/stratified_kfold.hpp"
+
+#include <Eigen/Dense>
+#include <utility>
+#include <vector>
+#include <cstddef>
+
+namespace mlpp::classifiers::kernel
+{
+
+/**
+ * Configuration for SVMSearch.
+ */
+struct SVMSearchOptions
+{
+    // Number of stratified cross-validation folds.
+    std::size_t folds = 5;
+
+    // Shuffle within each class before assigning folds.
+    bool shuffle = true;
+
+    // Seed for fold assignment and for random().
+    std::size_t seed = 0;
+
+    /**
+     * Successive halving.
+     *
+     * Every candidate is first scored on one fold; after each round
+     * only the best 1 / halving_factor are kept and evaluated on
+     * halving_factor times as many folds, until all folds are used or
+     * one candidate is left. Disabled, every candidate sees all folds.
+     */
+    bool halving = true;
+    std::size_t halving_factor = 3;
+
+    // Worker threads (0 = all hardware threads).
+    std::size_t threads = 0;
+
+    /**
+     * Budget in bytes for the n × n kernel matrices held at once.
+     *
+     * 0 holds one matrix at a time, so the search peaks at two n × n
+     * matrices including D. Any other value lets as many γ values be
+     * processed together as fit in it, but never more than the
+     * threads can keep busy.
+     */
+    std::size_t gram_bytes = 0;
+
+    // Stopping criteria of each SMO run.
+    SMOOptions solver;
+};
+
+/**
+ * Cross-validated score of one (C, γ) pair.
+ */
+struct SVMSearchCandidate
+{
+    double C = 0.0;
+    double gamma = 0.0;
+
+    // Mean validation accuracy over the evaluated folds.
+    double score = 0.0;
+
+    // Folds the candidate was evaluated on before it was dropped.
+    std::size_t folds = 0;
+
+    // SMO iterations summed over those folds.
+    std::size_t iterations = 0;
+};
+
+/**
+ * Hyperparameter search for the RBF SVM over C and γ.
+ *
+ * Candidates are scored by stratified k-fold accuracy. Work is shared
+ * between candidates wherever the math allows:
+ *
+ *  - The squared distances D_ij = ‖x_i − x_j‖² are computed once, by
+ *    one matrix product. Each γ then only needs K = exp(−γ D), which
+ *    every fold and every C reads through SubsetGram views.
+ *  - For a fixed γ and fold, candidates are solved in increasing C,
+ *    each starting from the previous α. Since 0 ≤ α ≤ C_prev ≤ C the
+ *    start is feasible and usually close to the new optimum.
+ *  - With successive halving, clearly losing candidates are dropped
+ *    after a few folds instead of being evaluated on all of them.
+ *
+ * Each (γ, fold) C path is one task on a thread pool. The folds of one
+ * γ share its n × n kernel matrix; more γ values are processed together
+ * only as far as SVMSearchOptions::gram_bytes allows.
+ */
+class SVMSearch
+{
+public:
+    /**
+     * @param data     Training samples
+     * @param labels   Class labels in {−1, +1}
+     * @param options  Search configuration
+     */
+    SVMSearch(const std::vector<Vector>& data,
+              Eigen::VectorXd labels,
+              SVMSearchOptions options = {});
+
+    /**
+     * Score every pair of Cs × gammas.
+     *
+     * @return Candidates ordered best first: by folds evaluated, then
+     *         by score. front() is the selected pair.
+     */
+    [[nodiscard]]
+    std::vector<SVMSearchCandidate> grid(const std::vector<double>& Cs,
+                                         const std::vector<double>& gammas) const;
+
+    /**
+     * Score a grid of values drawn log-uniformly from the given ranges.
+     *
+     * Drawing whole axes rather than independent pairs keeps the C
+     * paths that make warm starts pay off.
+     *
+     * @param C_range      [min, max] of C
+     * @param gamma_range  [min, max] of γ
+     * @param n_C          Number of C values
+     * @param n_gamma      Number of γ values
+     */
+    [[nodiscard]]
+    std::vector<SVMSearchCandidate> random(std::pair<double, double> C_range,
+                                           std::pair<double, double> gamma_range,
+                                           std::size_t n_C,
+                                           std::size_t n_gamma) const;
+
+private:
+    using Split = model_validation::StratifiedKFold<int>::Split;
+
+    /**
+     * Solve the C path of one γ on one fold and record the scores.
+     *
+     * @param K      exp(−γ D) over all samples
+     * @param chain  Candidate indices of this γ, sorted by C
+     */
+    void evaluate_path(const Eigen::MatrixXd& K,
+                       const std::vector<SVMSearchCandidate>& candidates,
+                       const std::vector<std::size_t>& chain,
+                       std::size_t fold,
+                       std::vector<double>& accuracy,
+                       std::vector<std::size_t>& iterations) const;
+
+private:
+    const std::vector<Vector>& data_;
+    Eigen::VectorXd labels_;
+    SVMSearchOptions options_;
+
+    Eigen::MatrixXd sq_dist_;
+    std::vector<Split> splits_;
+};
+
+} // namespace mlpp::classifiers::kernel
+
+#include "svm_search.inl"
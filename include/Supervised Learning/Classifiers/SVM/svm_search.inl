@@ -0,0 +1,278 @@
+// include/Supervised Learning/Classifiers/SVM/svm_search.inl
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <random>
+#include <stdexcept>
+
+#include "svm_search.hpp"
+#include "Kernel/precomputed_gram.hpp"
+#include "Kernel/subset_gram.hpp"
+#include "Parallel/thread_pool.hpp"
+
+namespace mlpp::classifiers::kernel
+{
+
+inline
+SVMSearch::SVMSearch(const std::vector<Vector>& data,
+                     Eigen::VectorXd labels,
+                     SVMSearchOptions options)
+    : data_(data),
+      labels_(std::move(labels)),
+      options_(options)
+{
+    const std::size_t n = data_.size();
+    const std::size_t dim = data_.empty() ? 0 : data_.front().size();
+
+    if (static_cast<std::size_t>(labels_.size()) != n)
+        throw std::invalid_argument("SVMSearch: labels size does not match data");
+    if (options_.halving && options_.halving_factor < 2)
+        throw std::invalid_argument("SVMSearch: halving_factor must be >= 2");
+
+    std::vector<int> classes(n);
+    for (std::size_t i = 0; i < n; ++i)
+        classes[i] = labels_(static_cast<Eigen::Index>(i)) > 0.0 ? 1 : 0;
+
+    splits_ = model_validation::StratifiedKFold<int>(options_.folds,
+                                                     options_.shuffle,
+                                                     options_.seed).split(classes);
+
+    // D = s 1ᵀ + 1 sᵀ − 2 X Xᵀ,  s_i = ‖x_i‖²
+    Eigen::MatrixXd X(n, dim);
+    for (std::size_t i = 0; i < n; ++i)
+        X.row(static_cast<Eigen::Index>(i)) =
+            Eigen::Map<const Eigen::RowVectorXd>(data_[i].data(),
+                                                 static_cast<Eigen::Index>(dim));
+
+    const Eigen::VectorXd sq = X.rowwise().squaredNorm();
+
+    sq_dist_.noalias() = -2.0 * X * X.transpose();
+    sq_dist_.colwise() += sq;
+    sq_dist_.rowwise() += sq.transpose();
+    sq_dist_ = sq_dist_.cwiseMax(0.0);
+}
+
+inline void
+SVMSearch::evaluate_path(const Eigen::MatrixXd& K,
+                         const std::vector<SVMSearchCandidate>& candidates,
+                         const std::vector<std::size_t>& chain,
+                         std::size_t fold,
+                         std::vector<double>& accuracy,
+                         std::vector<std::size_t>& iterations) const
+{
+    const std::size_t k = splits_.size();
+    const auto& [train, val] = splits_[fold];
+
+    Eigen::VectorXd y(static_cast<Eigen::Index>(train.size()));
+    for (std::size_t t = 0; t < train.size(); ++t)
+        y(static_cast<Eigen::Index>(t)) = labels_(static_cast<Eigen::Index>(train[t]));
+
+    const PrecomputedGram full(K);
+    const SubsetGram gram(full, train);
+
+    Eigen::VectorXd alpha = Eigen::VectorXd::Zero(y.size());
+    double bias = 0.0;
+
+    for (std::size_t c : chain)
+    {
+        // α of the previous, smaller C is a feasible start.
+        SMOSolver solver(gram, y, candidates[c].C, options_.solver);
+        const SolverReport report = solver.solve(alpha, bias);
+
+        std::size_t correct = 0;
+
+        for (std::size_t v : val)
+        {
+            double f = bias;
+            for (std::size_t t = 0; t < train.size(); ++t)
+            {
+                if (alpha(static_cast<Eigen::Index>(t)) > 0.0)
+                    f += alpha(static_cast<Eigen::Index>(t)) * y(static_cast<Eigen::Index>(t)) *
+                         full(train[t], v);
+            }
+
+            const double label = labels_(static_cast<Eigen::Index>(v));
+            if ((f >= 0.0 ? 1.0 : -1.0) == label)
+                ++correct;
+        }
+
+        accuracy[c * k + fold] = static_cast<double>(correct) /
+                                 static_cast<double>(std::max<std::size_t>(1, val.size()));
+        iterations[c * k + fold] = report.iterations;
+    }
+}
+
+inline std::vector<SVMSearchCandidate>
+SVMSearch::grid(const std::vector<double>& Cs,
+                const std::vector<double>& gammas) const
+{
+    if (Cs.empty() || gammas.empty())
+        throw std::invalid_argument("SVMSearch::grid: empty parameter list");
+
+    const std::size_t n = data_.size();
+    const std::size_t k = splits_.size();
+    const std::size_t G = gammas.size();
+
+    std::vector<SVMSearchCandidate> candidates;
+    std::vector<std::size_t> gamma_of;
+
+    for (std::size_t g = 0; g < G; ++g)
+    {
+        for (double C : Cs)
+        {
+            candidates.push_back({ C, gammas[g] });
+            gamma_of.push_back(g);
+        }
+    }
+
+    const std::size_t M = candidates.size();
+
+    std::vector<double> accuracy(M * k, 0.0);
+    std::vector<std::size_t> iterations(M * k, 0);
+
+    std::vector<std::size_t> survivors(M);
+    for (std::size_t c = 0; c < M; ++c)
+        survivors[c] = c;
+
+    const auto mean_score = [&](std::size_t c, std::size_t folds)
+    {
+        double sum = 0.0;
+        for (std::size_t f = 0; f < folds; ++f)
+            sum += accuracy[c * k + f];
+
+        return sum / static_cast<double>(folds);
+    };
+
+    const std::size_t threads = parallel::resolve_threads(options_.threads);
+    parallel::ThreadPool pool(threads - 1);
+
+    std::size_t done = 0;
+    std::size_t target = options_.halving ? 1 : k;
+
+    while (true)
+    {
+        // C paths of the surviving candidates, per γ.
+        std::vector<std::vector<std::size_t>> chains(G);
+        for (std::size_t c : survivors)
+            chains[gamma_of[c]].push_back(c);
+
+        std::vector<std::size_t> active;
+        for (std::size_t g = 0; g < G; ++g)
+        {
+            if (chains[g].empty())
+                continue;
+
+            std::ranges::sort(chains[g], {}, [&](std::size_t c) { return candidates[c].C; });
+            active.push_back(g);
+        }
+
+        // γ values in flight: enough to keep the threads busy, within gram_bytes.
+        const std::size_t new_folds = target - done;
+        const std::size_t busy = (threads + new_folds - 1) / new_folds;
+        const std::size_t affordable =
+            options_.gram_bytes / (sizeof(double) * std::max<std::size_t>(1, n * n));
+        const std::size_t batch = std::max<std::size_t>(1, std::min(busy, affordable));
+
+        std::vector<Eigen::MatrixXd> grams;
+
+        for (std::size_t first = 0; first < active.size(); first += batch)
+        {
+            const std::size_t B = std::min(batch, active.size() - first);
+
+            grams.resize(B);
+            for (std::size_t b = 0; b < B; ++b)
+                grams[b].resize(static_cast<Eigen::Index>(n), static_cast<Eigen::Index>(n));
+
+            // K = exp(−γ D), one column per task.
+            pool.parallel_for(B * n, [&](std::size_t u)
+            {
+                const std::size_t b = u / n;
+                const auto j = static_cast<Eigen::Index>(u % n);
+                const double gamma = gammas[active[first + b]];
+
+                grams[b].col(j) = (-gamma * sq_dist_.col(j)).array().exp();
+            });
+
+            pool.parallel_for(B * new_folds, [&](std::size_t u)
+            {
+                const std::size_t b = u / new_folds;
+                const std::size_t fold = done + u % new_folds;
+
+                evaluate_path(grams[b], candidates, chains[active[first + b]],
+                              fold, accuracy, iterations);
+            });
+        }
+
+        done = target;
+
+        for (std::size_t c : survivors)
+            candidates[c].folds = done;
+
+        if (done == k || survivors.size() <= 1)
+            break;
+
+        const std::size_t keep =
+            (survivors.size() + options_.halving_factor - 1) / options_.halving_factor;
+
+        std::ranges::stable_sort(survivors, std::greater<>{},
+                                 [&](std::size_t c) { return mean_score(c, done); });
+        survivors.resize(keep);
+
+        if (survivors.size() <= 1)
+            break;
+
+        target = std::min(k, target * options_.halving_factor);
+    }
+
+    for (std::size_t c = 0; c < M; ++c)
+    {
+        candidates[c].score = mean_score(c, candidates[c].folds);
+
+        for (std::size_t f = 0; f < candidates[c].folds; ++f)
+            candidates[c].iterations += iterations[c * k + f];
+    }
+
+    std::ranges::stable_sort(candidates, [](const SVMSearchCandidate& a,
+                                            const SVMSearchCandidate& b)
+    {
+        if (a.folds != b.folds)
+            return a.folds > b.folds;
+
+        return a.score > b.score;
+    });
+
+    return candidates;
+}
+
+inline std::vector<SVMSearchCandidate>
+SVMSearch::random(std::pair<double, double> C_range,
+                  std::pair<double, double> gamma_range,
+                  std::size_t n_C,
+                  std::size_t n_gamma) const
+{
+    if (!(C_range.first > 0.0 && C_range.first <= C_range.second &&
+          gamma_range.first > 0.0 && gamma_range.first <= gamma_range.second))
+        throw std::invalid_argument("SVMSearch::random: invalid range");
+
+    std::mt19937 rng(static_cast<std::mt19937::result_type>(options_.seed));
+
+    const auto draw = [&](std::pair<double, double> range, std::size_t count)
+    {
+        std::uniform_real_distribution<double> u(std::log(range.first),
+                                                 std::log(range.second));
+        std::vector<double> values(count);
+        for (double& v : values)
+            v = std::exp(u(rng));
+
+        return values;
+    };
+
+    const std::vector<double> Cs = draw(C_range, n_C);
+    const std::vector<double> gammas = draw(gamma_range, n_gamma);
+
+    return grid(Cs, gammas);
+}
+
+} // namespace mlpp::classifiers::kernel
@@ -11,9 +11,33 @@
 #include <cmath>
 #include <stdexcept>
 #include <unordered_map>
+#include <optional>
+#include <random>
+#include <cstdint>
+#include <utility>
+
+#include "Parallel/thread_pool.hpp"
+#include "feature_bins.h"
+#include "flat_tree.h"
 
 namespace decision_trees {
 
+// splitmix64 of seed and k: independent seeds for the parts of a model,
+// such as the two children of a node or the trees of an ensemble.
+std::uint64_t mix_seed(std::uint64_t seed, std::uint64_t k) noexcept;
+
+// Class tables of a classifier for string labels y: the sorted distinct
+// labels, coded 0, 1, ... in that order.
+void set_class_labels(const std::vector<std::string>& y,
+                      std::vector<std::string>& code_to_label,
+                      std::unordered_map<std::string, double>& label_to_code);
+
+// Class tables for y holding class codes. Throws unless every code is a
+// non-negative integer; classes 0 .. max(y) are named "0", "1", ...
+void set_class_codes(const std::vector<double>& y,
+                     std::vector<std::string>& code_to_label,
+                     std::unordered_map<std::string, double>& label_to_code);
+
 struct TreeNode {
     bool is_leaf{false};
     std::size_t feature_index{0};
@@ -40,7 +64,11 @@ public:
         std::size_t max_depth = std::numeric_limits<std::size_t>::max(),
         std::size_t min_samples_split = 2,
         std::size_t min_samples_leaf = 1,
-        double min_impurity_decrease = 0.0);
+        double min_impurity_decrease = 0.0,
+        std::size_t threads = 0,
+        std::size_t max_bins = 0,
+        std::size_t max_features = 0,
+        std::uint64_t seed = 0);
 
     virtual ~DecisionTree() = default;
 
@@ -56,6 +84,18 @@ public:
 
     const TreeNode* root() const noexcept { return root_.get(); }
 
+    // Recompile the fitted tree into the given layout; fit() compiles it
+    // into the last layout chosen here (breadth-first by default), and
+    // predictions read only the compiled form.
+    void compile(FlatLayout layout);
+
+    const FlatTree& flat() const noexcept { return flat_; }
+
+    // Predictions for rows samples stored row-major, cols values per row,
+    // written to out. Rows go through the tree in interleaved blocks, and
+    // large batches are split across the pool fit() created, if any.
+    void predict_batch(const double* X, std::size_t rows, std::size_t cols, double* out) const;
+
     const std::vector<std::string>& classes() const noexcept { return code_to_label_; }
 
     DecisionTree(const DecisionTree&) = delete;
@@ -65,14 +105,116 @@ public:
     
 
 protected:
+    // Best split of one feature; position is the last left sample in sorted
+    // order, or with histogram splits the last left bin.
+    struct Split {
+        double gain{-std::numeric_limits<double>::infinity()};
+        std::size_t feature{0};
+        double threshold{0.0};
+        std::size_t position{0};
+    };
+
+    // Features are searched in parallel from this many samples per node,
+    // and the two subtrees are built in parallel from twice as many.
+    static constexpr std::size_t parallel_split_min = 256;
+
+    // Pick the best split over the given features, ascending. Per-feature
+    // results are reduced in that order, so ties go to the lowest feature
+    // index and the tree does not depend on the thread count.
+    template <typename Search>
+    Split best_split(std::size_t n_samples, const std::vector<std::size_t>& features, Search&& search) const;
+
+    // Features searched at a node: all of them, or max_features drawn
+    // without replacement by a generator seeded with the node's seed, so
+    // the draw does not depend on the order nodes are built in.
+    std::vector<std::size_t> node_features(std::size_t n_features, std::uint64_t seed) const;
+
+    // Rows of X to fit on: samples, or all rows if it is null.
+    static std::vector<std::size_t> fit_indices(std::size_t rows, const std::vector<std::size_t>* samples);
+
+    // Run build(0) and build(1) for the two children, concurrently for large nodes.
+    template <typename Build>
+    void build_children(std::size_t n_samples, Build&& build) const;
+
+    // Rows per task of a parallel batched prediction.
+    static constexpr std::size_t parallel_predict_rows = 4096;
+
+    // Leaf node of count rows in flat_, see FlatTree::leaves_of. Runs on
+    // own_pool_, or serially without one.
+    template <typename Row>
+    std::vector<std::uint32_t> leaves_of(std::size_t count, Row&& row) const;
+
+    // Histogram of the samples in indices over the bins of every feature,
+    // stride values per bin; add(slot, i) accumulates sample i into slot.
+    template <typename Add>
+    std::vector<double> histogram(const std::vector<std::size_t>& indices,
+                                  std::size_t stride,
+                                  Add&& add) const;
+
+    // Histograms of both children. Only the smaller child is accumulated;
+    // the larger one is the parent minus it, computed in place in parent.
+    template <typename Add>
+    void child_histograms(std::vector<double>& parent,
+                          const std::vector<std::size_t>& left,
+                          const std::vector<std::size_t>& right,
+                          std::size_t stride,
+                          Add&& add,
+                          std::vector<double>& left_hist,
+                          std::vector<double>& right_hist) const;
+
+    // Rows of a node in ascending order of each feature, ties by row, for
+    // exact split search. fit() sorts every feature once; a split node
+    // stable-partitions its lists into its children's, so no node sorts.
+    using SortedColumns = std::vector<std::vector<std::size_t>>;
+
+    // Sorted columns of the rows in indices, one feature per task.
+    SortedColumns presort(const std::vector<std::vector<double>>& X,
+                          const std::vector<std::size_t>& indices) const;
+
+    // Split every column of a node between its children, keeping the
+    // order, and release the node's columns.
+    void partition_columns(SortedColumns& columns,
+                           const Split& split,
+                           SortedColumns& left,
+                           SortedColumns& right);
+
+    // Children of a histogram split, in the order of indices.
+    void split_binned(const std::vector<std::size_t>& indices,
+                      const Split& split,
+                      std::vector<std::size_t>& left,
+                      std::vector<std::size_t>& right) const;
+
     Task task_;
     Criterion criterion_;
     std::size_t max_depth_;
     std::size_t min_samples_split_;
     std::size_t min_samples_leaf_;
     double min_impurity_decrease_;
+    std::size_t threads_{0};  // 0 = all hardware threads
+    std::size_t max_bins_{0};  // 0 = exact splits, else histogram splits over at most this many bins
+    std::size_t max_features_{0};  // features tried per split, 0 = all
+    std::uint64_t seed_{0};        // seed of the feature draws
+
+    // Pool used while fit() runs; null otherwise.
+    mlpp::parallel::ThreadPool* pool_{nullptr};
+
+    // Pool of threads_ threads, created by the first fit() that does not
+    // run on a caller's pool and kept for batched prediction.
+    std::shared_ptr<mlpp::parallel::ThreadPool> own_pool_;
+
+    // own_pool_, created on first use.
+    mlpp::parallel::ThreadPool& own_pool();
+
+    // Binned training features while a histogram fit() runs; null otherwise.
+    const FeatureBins* bins_{nullptr};
+
+    // Side (1 = left) of every row of the node being partitioned while an
+    // exact fit() runs. Nodes built concurrently hold disjoint rows.
+    std::vector<std::uint8_t> goes_left_;
 
     std::unique_ptr<TreeNode> root_;
+    FlatTree flat_;
+    FlatLayout layout_{FlatLayout::breadth_first};
 
     std::vector<std::string> class_names_;
     std::unordered_map<std::string, double> label_to_code_;
@@ -83,28 +225,84 @@ class DecisionTreeClassifier : public DecisionTree {
 private:
     void build_tree(const std::vector<std::vector<double>>& X,
                     const std::vector<double>& y,
-                    const std::vector<std::size_t>& indices,
+                    SortedColumns columns,
                     std::size_t depth,
+                    std::uint64_t seed,
                     TreeNode& node);
 
     void make_leaf(TreeNode& node,
                    const std::vector<double>& y,
                    const std::vector<std::size_t>& indices);
 
+    // Sweep the rows of the node once in sorted order of feature f, moving
+    // one sample at a time from the right to the left side and updating
+    // the class counts.
+    Split feature_split(const std::vector<std::vector<double>>& X,
+                        const std::vector<double>& y,
+                        const std::vector<std::size_t>& sorted,
+                        std::size_t f,
+                        double parent_imp,
+                        const std::vector<std::size_t>& class_counts) const;
+
+    // Impurity of one side from its size n, Σ c² and Σ c log2 c over class counts c.
+    double count_impurity(std::size_t n, double sum_sq, double sum_clogc) const noexcept;
+
+    // Impurity of n samples with the given class counts.
+    double counts_impurity(const std::vector<std::size_t>& class_counts, std::size_t n) const noexcept;
+
+    // Histogram counterpart of build_tree; hist holds per-bin class counts
+    // of the node, empty when the node cannot split.
+    void build_tree_binned(const std::vector<double>& y,
+                           const std::vector<std::size_t>& indices,
+                           std::size_t depth,
+                           std::uint64_t seed,
+                           TreeNode& node,
+                           std::vector<double> hist);
+
+    // Best split of feature f between two adjacent bins.
+    Split binned_split(const std::vector<double>& hist,
+                       std::size_t f,
+                       std::size_t n,
+                       double parent_imp,
+                       const std::vector<std::size_t>& class_counts) const;
+
+    // Validate class codes and name the classes "0", "1", ...
+    void set_codes(const std::vector<double>& y);
+
+    // Build the tree for y holding class codes 0 .. classes().size() - 1,
+    // on the rows in samples (all if null).
+    void fit_codes(const std::vector<std::vector<double>>& X,
+                   const std::vector<double>& y,
+                   const std::vector<std::size_t>* samples,
+                   const FeatureBins* bins);
+
 public:
     DecisionTreeClassifier(
         Criterion criterion = Criterion::gini,
         std::size_t max_depth = std::numeric_limits<std::size_t>::max(),
         std::size_t min_samples_split = 2,
         std::size_t min_samples_leaf = 1,
-        double min_impurity_decrease = 0.0);
+        double min_impurity_decrease = 0.0,
+        std::size_t threads = 0,
+        std::size_t max_bins = 0,
+        std::size_t max_features = 0,
+        std::uint64_t seed = 0);
 
     void fit(const std::vector<std::vector<double>>& X,
              const std::vector<std::string>& y) override;
 
+    // y holds class codes: non-negative integers, named "0", "1", ...
     void fit(const std::vector<std::vector<double>>& X,
              const std::vector<double>& y) override;
 
+    // Fit on the rows listed in samples; repeats count as extra copies,
+    // as in a bootstrap sample. bins, if not null, must be FeatureBins of
+    // X and is used instead of binning X again when max_bins != 0.
+    void fit(const std::vector<std::vector<double>>& X,
+             const std::vector<double>& y,
+             const std::vector<std::size_t>& samples,
+             const FeatureBins* bins = nullptr);
+
     double predict(const std::vector<double>& x) const override;
     std::vector<double> predict(const std::vector<std::vector<double>>& X) const override;
 
@@ -112,27 +310,94 @@ public:
     std::vector<std::string> predict_class(const std::vector<std::vector<double>>& X) const;
 
     std::vector<double> predict_proba(const std::vector<double>& x) const;
+
+    // Class probabilities of rows samples stored row-major, written to out
+    // as rows × classes().size().
+    void predict_proba_batch(const double* X, std::size_t rows, std::size_t cols, double* out) const;
 };
 
 class DecisionTreeRegressor : public DecisionTree {
 private:
     void build_tree(const std::vector<std::vector<double>>& X,
                     const std::vector<double>& y,
-                    const std::vector<std::size_t>& indices,
+                    SortedColumns columns,
                     std::size_t depth,
+                    std::uint64_t seed,
                     TreeNode& node);
 
     void make_leaf(TreeNode& node,
                    const std::vector<double>& y,
                    const std::vector<std::size_t>& indices);
 
+    // For mse, sweep the rows of the node once in sorted order of feature
+    // f with running sums of y and y²; mae re-evaluates each side per
+    // threshold.
+    Split feature_split(const std::vector<std::vector<double>>& X,
+                        const std::vector<double>& y,
+                        const std::vector<std::size_t>& sorted,
+                        std::size_t f,
+                        double parent_imp) const;
+
+    // Histogram counterpart of build_tree for mse; hist holds the count and
+    // the sum of y - shift per bin, empty when the node cannot split.
+    void build_tree_binned(const std::vector<double>& y,
+                           double shift,
+                           const std::vector<std::size_t>& indices,
+                           std::size_t depth,
+                           std::uint64_t seed,
+                           TreeNode& node,
+                           std::vector<double> hist);
+
+    // Best split of feature f between two adjacent bins; sum is Σ (y - shift)
+    // over the node.
+    Split binned_split(const std::vector<double>& hist,
+                       std::size_t f,
+                       std::size_t n,
+                       double sum) const;
+
+    // Per-row gradients and hessians of a boosting round and the L2
+    // penalty λ on leaf values, see fit_gradients.
+    struct Gradients {
+        const std::vector<double>& g;
+        const std::vector<double>& h;
+        double lambda;
+    };
+
+    // Histogram counterpart of build_tree on gradients; hist holds the
+    // count and the sums of g and h per bin, empty when the node cannot split.
+    void build_tree_gradients(const Gradients& grad,
+                              const std::vector<std::size_t>& indices,
+                              std::size_t depth,
+                              std::uint64_t seed,
+                              TreeNode& node,
+                              std::vector<double> hist);
+
+    // Best split of feature f between two adjacent bins; G and H are the
+    // node's gradient and hessian sums.
+    Split gradient_split(const std::vector<double>& hist,
+                         std::size_t f,
+                         std::size_t n,
+                         double G,
+                         double H,
+                         double lambda) const;
+
+    // Build the tree on the rows in samples (all if null).
+    void fit_rows(const std::vector<std::vector<double>>& X,
+                  const std::vector<double>& y,
+                  const std::vector<std::size_t>* samples,
+                  const FeatureBins* bins);
+
 public:
     DecisionTreeRegressor(
         Criterion criterion = Criterion::mse,
         std::size_t max_depth = std::numeric_limits<std::size_t>::max(),
         std::size_t min_samples_split = 2,
         std::size_t min_samples_leaf = 1,
-        double min_impurity_decrease = 0.0);
+        double min_impurity_decrease = 0.0,
+        std::size_t threads = 0,
+        std::size_t max_bins = 0,
+        std::size_t max_features = 0,
+        std::uint64_t seed = 0);
 
     void fit(const std::vector<std::vector<double>>& X,
              const std::vector<std::string>& y) override;
@@ -140,6 +405,33 @@ public:
     void fit(const std::vector<std::vector<double>>& X,
              const std::vector<double>& y) override;
 
+    // Fit on the rows listed in samples, see DecisionTreeClassifier::fit.
+    void fit(const std::vector<std::vector<double>>& X,
+             const std::vector<double>& y,
+             const std::vector<std::size_t>& samples,
+             const FeatureBins* bins = nullptr);
+
+    // One Newton step of gradient boosting: fit the rows in samples to
+    // per-row gradients and hessians, with histogram splits over bins of
+    // the training features. A split is scored by the loss reduction
+    //   ½ (G_l² / (H_l + λ) + G_r² / (H_r + λ) − G² / (H + λ))
+    // over the gradient and hessian sums G, H of each side and must reach
+    // min_impurity_decrease; a leaf predicts −G / (H + λ).
+    void fit_gradients(const FeatureBins& bins,
+                       const std::vector<double>& gradients,
+                       const std::vector<double>& hessians,
+                       const std::vector<std::size_t>& samples,
+                       double lambda = 1.0);
+
+    // As above, on the caller's pool instead of the tree's own, so a model
+    // fitting many trees keeps one set of threads.
+    void fit_gradients(const FeatureBins& bins,
+                       const std::vector<double>& gradients,
+                       const std::vector<double>& hessians,
+                       const std::vector<std::size_t>& samples,
+                       double lambda,
+                       mlpp::parallel::ThreadPool& pool);
+
     double predict(const std::vector<double>& x) const override;
     std::vector<double> predict(const std::vector<std::vector<double>>& X) const override;
 };
@@ -4,6 +4,42 @@
 
 namespace decision_trees {
 
+std::uint64_t mix_seed(std::uint64_t seed, std::uint64_t k) noexcept {
+    std::uint64_t z = seed + (k + 1) * 0x9E3779B97F4A7C15ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+void set_class_labels(const std::vector<std::string>& y,
+                      std::vector<std::string>& code_to_label,
+                      std::unordered_map<std::string, double>& label_to_code) {
+    code_to_label.assign(y.begin(), y.end());
+    std::sort(code_to_label.begin(), code_to_label.end());
+    code_to_label.erase(std::unique(code_to_label.begin(), code_to_label.end()), code_to_label.end());
+
+    label_to_code.clear();
+    for (std::size_t i = 0; i < code_to_label.size(); ++i) label_to_code[code_to_label[i]] = static_cast<double>(i);
+}
+
+void set_class_codes(const std::vector<double>& y,
+                     std::vector<std::string>& code_to_label,
+                     std::unordered_map<std::string, double>& label_to_code) {
+    double max_code = 0.0;
+    for (double v : y) {
+        if (v < 0.0 || v != std::floor(v))
+            throw std::invalid_argument("Class codes must be non-negative integers");
+        max_code = std::max(max_code, v);
+    }
+
+    code_to_label.clear();
+    label_to_code.clear();
+    for (std::size_t c = 0; c <= static_cast<std::size_t>(max_code); ++c) {
+        code_to_label.push_back(std::to_string(c));
+        label_to_code[code_to_label.back()] = static_cast<double>(c);
+    }
+}
+
 namespace {
 
 inline bool all_labels_same(const std::vector<double>& y,
@@ -14,32 +50,6 @@ inline bool all_labels_same(const std::vector<double>& y,
                        [&y, first](std::size_t i) { return y[i] == first; });
 }
 
-inline double gini_impurity(const std::vector<double>& y,
-                            const std::vector<std::size_t>& indices) {
-    if (indices.size() <= 1) return 0.0;
-    std::unordered_map<double, std::size_t> counts;
-    for (std::size_t i : indices) ++counts[y[i]];
-    double imp = 1.0;
-    for (const auto& p : counts) {
-        double p_i = static_cast<double>(p.second) / indices.size();
-        imp -= p_i * p_i;
-    }
-    return imp;
-}
-
-inline double entropy(const std::vector<double>& y,
-                      const std::vector<std::size_t>& indices) {
-    if (indices.size() <= 1) return 0.0;
-    std::unordered_map<double, std::size_t> counts;
-    for (std::size_t i : indices) ++counts[y[i]];
-    double ent = 0.0;
-    for (const auto& p : counts) {
-        double p_i = static_cast<double>(p.second) / indices.size();
-        if (p_i > 0.0) ent -= p_i * std::log2(p_i);
-    }
-    return ent;
-}
-
 inline double variance(const std::vector<double>& y,
                        const std::vector<std::size_t>& indices) {
     if (indices.size() <= 1) return 0.0;
@@ -67,6 +77,11 @@ inline double mean_absolute_deviation(const std::vector<double>& y,
     return mad / vals.size();
 }
 
+// c log2 c, with 0 log2 0 = 0.
+inline double xlog2x(std::size_t c) {
+    return c > 1 ? c * std::log2(static_cast<double>(c)) : 0.0;
+}
+
 }  // anonymous namespace
 
 DecisionTree::DecisionTree(
@@ -75,29 +90,354 @@ DecisionTree::DecisionTree(
     std::size_t max_depth,
     std::size_t min_samples_split,
     std::size_t min_samples_leaf,
-    double min_impurity_decrease)
+    double min_impurity_decrease,
+    std::size_t threads,
+    std::size_t max_bins,
+    std::size_t max_features,
+    std::uint64_t seed)
     : task_(task),
       criterion_(criterion),
       max_depth_(max_depth),
       min_samples_split_(min_samples_split),
       min_samples_leaf_(min_samples_leaf),
-      min_impurity_decrease_(min_impurity_decrease) {}
+      min_impurity_decrease_(min_impurity_decrease),
+      threads_(threads),
+      max_bins_(max_bins),
+      max_features_(max_features),
+      seed_(seed) {}
+
+FlatTree::FlatTree(const TreeNode& root, std::size_t n_classes, FlatLayout layout)
+    : n_classes_(n_classes),
+      layout_(layout) {
+    // Units in breadth-first order; a unit's children always come later.
+    std::vector<Unit> units(1);
+    units[0].node[0] = &root;
+    units[0].count = 1;
+
+    for (std::size_t u = 0; u < units.size(); ++u) {
+        for (std::size_t k = 0; k < units[u].count; ++k) {
+            const TreeNode* node = units[u].node[k];
+            if (node->is_leaf) continue;
+
+            Unit pair;
+            pair.node[0] = node->left.get();
+            pair.node[1] = node->right.get();
+            pair.count = 2;
+            units[u].child[k] = units.size();
+            units.push_back(pair);
+        }
+    }
+
+    for (std::size_t u = units.size(); u-- > 0;) {
+        for (std::size_t k = 0; k < units[u].count; ++k) {
+            if (!units[u].node[k]->is_leaf)
+                units[u].height = std::max(units[u].height, units[units[u].child[k]].height + 1);
+        }
+    }
+
+    std::vector<std::size_t> order;
+    order.reserve(units.size());
+    if (layout == FlatLayout::van_emde_boas) {
+        van_emde_boas(units, 0, units[0].height, order);
+    } else {
+        for (std::size_t u = 0; u < units.size(); ++u) order.push_back(u);
+    }
+
+    // Batched traversal addresses nodes in 32-bit words.
+    const std::size_t n_nodes = 2 * units.size() - 1;
+    if (n_nodes >= (std::size_t{1} << 29)) throw std::length_error("Tree too large to flatten");
+    depth_ = units[0].height - 1;
+
+    std::vector<std::size_t> base(units.size());
+    std::size_t next = 0;
+    for (std::size_t u : order) {
+        base[u] = next;
+        next += units[u].count;
+    }
+
+    nodes_.resize(n_nodes);
+    std::uint32_t leaves = 0;
+
+    for (std::size_t u : order) {
+        for (std::size_t k = 0; k < units[u].count; ++k) {
+            const TreeNode* node = units[u].node[k];
+            Node& flat = nodes_[base[u] + k];
+
+            if (!node->is_leaf) {
+                if (node->feature_index >= leaf) throw std::length_error("Feature index too large to flatten");
+                flat = {node->threshold,
+                        static_cast<std::uint32_t>(node->feature_index),
+                        static_cast<std::uint32_t>(base[units[u].child[k]])};
+                continue;
+            }
+
+            flat = {node->value, leaf, leaves++};
+
+            if (n_classes_ == 0) continue;
+
+            // Same rule as predict_proba on the node tree: class frequencies,
+            // or all mass on the predicted class for a leaf without counts.
+            std::size_t total = 0;
+            for (std::size_t cnt : node->class_counts) total += cnt;
+
+            const std::size_t first = probabilities_.size();
+            probabilities_.resize(first + n_classes_, 0.0);
+            if (total == 0) {
+                probabilities_[first + static_cast<std::size_t>(node->value)] = 1.0;
+            } else {
+                for (std::size_t c = 0; c < n_classes_ && c < node->class_counts.size(); ++c)
+                    probabilities_[first + c] = static_cast<double>(node->class_counts[c]) / total;
+            }
+        }
+    }
+}
+
+void FlatTree::van_emde_boas(const std::vector<Unit>& units,
+                             std::size_t u,
+                             std::size_t height,
+                             std::vector<std::size_t>& order) {
+    if (height == 1) {
+        order.push_back(u);
+        return;
+    }
+
+    const std::size_t top = height / 2;
+    van_emde_boas(units, u, top, order);
+
+    // Roots of the bottom subtrees, top levels below u.
+    std::vector<std::size_t> frontier{u};
+    for (std::size_t level = 0; level < top; ++level) {
+        std::vector<std::size_t> below;
+        for (std::size_t v : frontier) {
+            for (std::size_t k = 0; k < units[v].count; ++k) {
+                if (!units[v].node[k]->is_leaf) below.push_back(units[v].child[k]);
+            }
+        }
+        frontier = std::move(below);
+    }
+
+    for (std::size_t v : frontier) van_emde_boas(units, v, height - top, order);
+}
+
+template <typename Row>
+std::vector<std::uint32_t> DecisionTree::leaves_of(std::size_t count, Row&& row) const {
+    if (count == 0) return {};
+    if (flat_.empty()) throw std::runtime_error("Tree not fitted");
+
+    std::vector<std::uint32_t> leaves(count);
+    const std::size_t tasks = (count + parallel_predict_rows - 1) / parallel_predict_rows;
+
+    auto run = [&](std::size_t t) {
+        const std::size_t first = t * parallel_predict_rows;
+        const std::size_t m = std::min(parallel_predict_rows, count - first);
+        flat_.leaves_of(m, [&](std::size_t r) { return row(first + r); }, leaves.data() + first);
+    };
+
+    if (own_pool_ && tasks > 1) {
+        own_pool_->parallel_for(tasks, run);
+    } else {
+        for (std::size_t t = 0; t < tasks; ++t) run(t);
+    }
+    return leaves;
+}
+
+mlpp::parallel::ThreadPool& DecisionTree::own_pool() {
+    if (!own_pool_)
+        own_pool_ = std::make_shared<mlpp::parallel::ThreadPool>(mlpp::parallel::resolve_threads(threads_) - 1);
+    return *own_pool_;
+}
+
+void DecisionTree::predict_batch(const double* X, std::size_t rows, std::size_t cols, double* out) const {
+    const std::vector<std::uint32_t> leaves = leaves_of(rows, [&](std::size_t r) { return X + r * cols; });
+    for (std::size_t r = 0; r < rows; ++r) out[r] = flat_.leaf_value(leaves[r]);
+}
+
+void DecisionTree::compile(FlatLayout layout) {
+    if (!root_) throw std::runtime_error("Tree not fitted");
+    layout_ = layout;
+    flat_ = FlatTree(*root_, code_to_label_.size(), layout_);
+}
+
+template <typename Search>
+DecisionTree::Split DecisionTree::best_split(std::size_t n_samples,
+                                             const std::vector<std::size_t>& features,
+                                             Search&& search) const {
+    const std::size_t n_features = features.size();
+    std::vector<Split> per_feature(n_features);
+
+    if (pool_ && n_samples >= parallel_split_min && n_features > 1) {
+        pool_->parallel_for(n_features, [&](std::size_t k) { per_feature[k] = search(features[k]); });
+    } else {
+        for (std::size_t k = 0; k < n_features; ++k) per_feature[k] = search(features[k]);
+    }
+
+    Split best;
+    for (const Split& s : per_feature) {
+        if (s.gain > best.gain) best = s;
+    }
+    return best;
+}
+
+std::vector<std::size_t> DecisionTree::node_features(std::size_t n_features, std::uint64_t seed) const {
+    std::vector<std::size_t> features(n_features);
+    std::iota(features.begin(), features.end(), 0);
+    if (max_features_ == 0 || max_features_ >= n_features) return features;
+
+    // Partial Fisher-Yates shuffle.
+    std::mt19937_64 rng(seed);
+    for (std::size_t k = 0; k < max_features_; ++k) {
+        std::uniform_int_distribution<std::size_t> pick(k, n_features - 1);
+        std::swap(features[k], features[pick(rng)]);
+    }
+    features.resize(max_features_);
+    std::sort(features.begin(), features.end());
+    return features;
+}
+
+std::vector<std::size_t> DecisionTree::fit_indices(std::size_t rows, const std::vector<std::size_t>* samples) {
+    if (!samples) {
+        std::vector<std::size_t> indices(rows);
+        std::iota(indices.begin(), indices.end(), 0);
+        return indices;
+    }
+    if (samples->empty()) throw std::invalid_argument("No samples to fit on");
+    for (std::size_t i : *samples) {
+        if (i >= rows) throw std::out_of_range("Sample index out of range");
+    }
+    return *samples;
+}
+
+template <typename Build>
+void DecisionTree::build_children(std::size_t n_samples, Build&& build) const {
+    if (pool_ && n_samples >= 2 * parallel_split_min) {
+        pool_->parallel_for(2, build);
+    } else {
+        build(0);
+        build(1);
+    }
+}
+
+template <typename Add>
+std::vector<double> DecisionTree::histogram(const std::vector<std::size_t>& indices,
+                                            std::size_t stride,
+                                            Add&& add) const {
+    const FeatureBins& bins = *bins_;
+    std::vector<double> hist(bins.total_bins() * stride, 0.0);
+
+    auto fill = [&](std::size_t f) {
+        const std::uint8_t* col = bins.column(f);
+        double* h = &hist[bins.offset(f) * stride];
+        for (std::size_t i : indices) add(h + col[i] * stride, i);
+    };
+
+    if (pool_ && indices.size() >= parallel_split_min && bins.features() > 1) {
+        pool_->parallel_for(bins.features(), fill);
+    } else {
+        for (std::size_t f = 0; f < bins.features(); ++f) fill(f);
+    }
+    return hist;
+}
+
+template <typename Add>
+void DecisionTree::child_histograms(std::vector<double>& parent,
+                                    const std::vector<std::size_t>& left,
+                                    const std::vector<std::size_t>& right,
+                                    std::size_t stride,
+                                    Add&& add,
+                                    std::vector<double>& left_hist,
+                                    std::vector<double>& right_hist) const {
+    const bool left_smaller = left.size() <= right.size();
+    std::vector<double> smaller = histogram(left_smaller ? left : right, stride, add);
+
+    for (std::size_t k = 0; k < parent.size(); ++k) parent[k] -= smaller[k];
+
+    left_hist = left_smaller ? std::move(smaller) : std::move(parent);
+    right_hist = left_smaller ? std::move(parent) : std::move(smaller);
+}
+
+void DecisionTree::split_binned(const std::vector<std::size_t>& indices,
+                                const Split& split,
+                                std::vector<std::size_t>& left,
+                                std::vector<std::size_t>& right) const {
+    const std::uint8_t* col = bins_->column(split.feature);
+    for (std::size_t i : indices) (col[i] <= split.position ? left : right).push_back(i);
+}
+
+DecisionTree::SortedColumns DecisionTree::presort(const std::vector<std::vector<double>>& X,
+                                                  const std::vector<std::size_t>& indices) const {
+    SortedColumns columns(X[0].size());
+
+    auto sort_feature = [&](std::size_t f) {
+        std::vector<std::pair<double, std::size_t>> sorted(indices.size());
+        for (std::size_t j = 0; j < indices.size(); ++j) sorted[j] = {X[indices[j]][f], indices[j]};
+        std::sort(sorted.begin(), sorted.end());
+
+        columns[f].resize(sorted.size());
+        for (std::size_t j = 0; j < sorted.size(); ++j) columns[f][j] = sorted[j].second;
+    };
+
+    if (pool_ && columns.size() > 1) {
+        pool_->parallel_for(columns.size(), sort_feature);
+    } else {
+        for (std::size_t f = 0; f < columns.size(); ++f) sort_feature(f);
+    }
+    return columns;
+}
+
+void DecisionTree::partition_columns(SortedColumns& columns,
+                                     const Split& split,
+                                     SortedColumns& left,
+                                     SortedColumns& right) {
+    // The split column is already ordered left side first. Copies of a
+    // bootstrapped row are adjacent there and never straddle a threshold.
+    const std::vector<std::size_t>& by_split = columns[split.feature];
+    const std::size_t n = by_split.size();
+    const std::size_t n_left = split.position + 1;
+    for (std::size_t k = 0; k < n; ++k) goes_left_[by_split[k]] = k < n_left;
+
+    left.resize(columns.size());
+    right.resize(columns.size());
+
+    auto partition = [&](std::size_t f) {
+        left[f].reserve(n_left);
+        right[f].reserve(n - n_left);
+        for (std::size_t i : columns[f]) (goes_left_[i] ? left[f] : right[f]).push_back(i);
+    };
+
+    if (pool_ && n >= parallel_split_min && columns.size() > 1) {
+        pool_->parallel_for(columns.size(), partition);
+    } else {
+        for (std::size_t f = 0; f < columns.size(); ++f) partition(f);
+    }
+    SortedColumns().swap(columns);
+}
 
 DecisionTreeClassifier::DecisionTreeClassifier(
     Criterion criterion,
     std::size_t max_depth,
     std::size_t min_samples_split,
     std::size_t min_samples_leaf,
-    double min_impurity_decrease) {
+    double min_impurity_decrease,
+    std::size_t threads,
+    std::size_t max_bins,
+    std::size_t max_features,
+    std::uint64_t seed) {
     task_ = Task::classification;
     criterion_ = criterion;
     max_depth_ = max_depth;
     min_samples_split_ = min_samples_split;
     min_samples_leaf_ = min_samples_leaf;
     min_impurity_decrease_ = min_impurity_decrease;
+    threads_ = threads;
+    max_bins_ = max_bins;
+    max_features_ = max_features;
+    seed_ = seed;
     if (criterion_ != Criterion::gini && criterion_ != Criterion::entropy) {
         throw std::invalid_argument("Invalid criterion for classifier");
     }
+    if (max_bins_ != 0 && (max_bins_ < 2 || max_bins_ > FeatureBins::max_bins_limit)) {
+        throw std::invalid_argument("max_bins must be 0 or in [2, 256]");
+    }
 }
 
 void DecisionTreeClassifier::fit(const std::vector<std::vector<double>>& X,
@@ -105,41 +445,172 @@ void DecisionTreeClassifier::fit(const std::vector<std::vector<double>>& X,
     if (X.empty() || X.size() != y.size())
         throw std::invalid_argument("X and y size mismatch");
 
-    class_names_.assign(y.begin(), y.end());
-    std::sort(class_names_.begin(), class_names_.end());
-    class_names_.erase(std::unique(class_names_.begin(), class_names_.end()), class_names_.end());
-
-    label_to_code_.clear();
-    code_to_label_.clear();
-    for (std::size_t i = 0; i < class_names_.size(); ++i) {
-        label_to_code_[class_names_[i]] = static_cast<double>(i);
-        code_to_label_.push_back(class_names_[i]);
-    }
+    set_class_labels(y, code_to_label_, label_to_code_);
+    class_names_ = code_to_label_;
 
     std::vector<double> y_num(y.size());
     for (std::size_t i = 0; i < y.size(); ++i) y_num[i] = label_to_code_.at(y[i]);
 
-    fit(X, y_num);
+    fit_codes(X, y_num, nullptr, nullptr);
 }
 
 void DecisionTreeClassifier::fit(const std::vector<std::vector<double>>& X,
                                  const std::vector<double>& y) {
+    if (X.empty() || X.size() != y.size())
+        throw std::invalid_argument("X and y size mismatch");
+
+    set_codes(y);
+    fit_codes(X, y, nullptr, nullptr);
+}
+
+void DecisionTreeClassifier::fit(const std::vector<std::vector<double>>& X,
+                                 const std::vector<double>& y,
+                                 const std::vector<std::size_t>& samples,
+                                 const FeatureBins* bins) {
+    if (X.empty() || X.size() != y.size())
+        throw std::invalid_argument("X and y size mismatch");
+
+    set_codes(y);
+    fit_codes(X, y, &samples, bins);
+}
+
+void DecisionTreeClassifier::set_codes(const std::vector<double>& y) {
+    set_class_codes(y, code_to_label_, label_to_code_);
+    class_names_ = code_to_label_;
+}
+
+void DecisionTreeClassifier::fit_codes(const std::vector<std::vector<double>>& X,
+                                       const std::vector<double>& y,
+                                       const std::vector<std::size_t>* samples,
+                                       const FeatureBins* bins) {
     if (X.empty() || X.size() != y.size() || (not X.empty() and X[0].empty()))
         throw std::invalid_argument("Invalid input data");
+    if (bins && (bins->rows() != X.size() || bins->features() != X[0].size()))
+        throw std::invalid_argument("FeatureBins do not match X");
+
+    const std::vector<std::size_t> indices = fit_indices(X.size(), samples);
 
     root_ = std::make_unique<TreeNode>();
+    flat_ = FlatTree();
+
+    pool_ = &own_pool();
+
+    try {
+        if (max_bins_ == 0) {
+            goes_left_.assign(X.size(), 0);
+            build_tree(X, y, presort(X, indices), 0, seed_, *root_);
+        } else {
+            std::optional<FeatureBins> own;
+            if (!bins) bins = &own.emplace(X, max_bins_);
+            bins_ = bins;
+
+            const std::size_t K = code_to_label_.size();
+            std::vector<double> hist = histogram(indices, K, [&](double* slot, std::size_t i) {
+                ++slot[static_cast<std::size_t>(y[i])];
+            });
+            build_tree_binned(y, indices, 0, seed_, *root_, std::move(hist));
+        }
+    } catch (...) {
+        pool_ = nullptr;
+        bins_ = nullptr;
+        std::vector<std::uint8_t>().swap(goes_left_);
+        throw;
+    }
+    pool_ = nullptr;
+    bins_ = nullptr;
+    std::vector<std::uint8_t>().swap(goes_left_);
+
+    compile(layout_);
+}
+
+double DecisionTreeClassifier::count_impurity(std::size_t n,
+                                              double sum_sq,
+                                              double sum_clogc) const noexcept {
+    if (n <= 1) return 0.0;
+    const double size = static_cast<double>(n);
+    if (criterion_ == Criterion::gini) return 1.0 - sum_sq / (size * size);
+    return std::log2(size) - sum_clogc / size;
+}
+
+double DecisionTreeClassifier::counts_impurity(const std::vector<std::size_t>& class_counts,
+                                               std::size_t n) const noexcept {
+    double sum_sq = 0.0, sum_clogc = 0.0;
+    for (std::size_t c : class_counts) {
+        sum_sq += static_cast<double>(c) * c;
+        sum_clogc += xlog2x(c);
+    }
+    return count_impurity(n, sum_sq, sum_clogc);
+}
+
+DecisionTree::Split DecisionTreeClassifier::feature_split(const std::vector<std::vector<double>>& X,
+                                                          const std::vector<double>& y,
+                                                          const std::vector<std::size_t>& sorted,
+                                                          std::size_t f,
+                                                          double parent_imp,
+                                                          const std::vector<std::size_t>& class_counts) const {
+    std::size_t n = sorted.size();
+    Split best;
+    best.feature = f;
+
+    // Running Σ c² and Σ c log2 c of both sides; only the one the criterion needs.
+    const bool gini = criterion_ == Criterion::gini;
+
+    std::vector<std::size_t> left(class_counts.size(), 0);
+    double sq_left = 0.0, sq_right = 0.0, cl_left = 0.0, cl_right = 0.0;
+    for (std::size_t c : class_counts) {
+        if (gini) sq_right += static_cast<double>(c) * c;
+        else cl_right += xlog2x(c);
+    }
+
+    double value = n != 0 ? X[sorted[0]][f] : 0.0;
+
+    for (std::size_t k = 0; k + 1 < n; ++k) {
+        const double next = X[sorted[k + 1]][f];
+        const double current = std::exchange(value, next);
+
+        const auto cls = static_cast<std::size_t>(y[sorted[k]]);
+        const std::size_t l = left[cls]++;
+        const std::size_t r = class_counts[cls] - l;
+
+        if (gini) {
+            sq_left += 2.0 * l + 1.0;
+            sq_right -= 2.0 * r - 1.0;
+        } else {
+            cl_left += xlog2x(l + 1) - xlog2x(l);
+            cl_right += xlog2x(r - 1) - xlog2x(r);
+        }
+
+        if (k + 1 < min_samples_leaf_) continue;
+        if (k + min_samples_leaf_ >= n) break;
+        if (current == next) continue;
+        double thresh = (current + next) / 2.0;
+
+        const std::size_t n_left = k + 1;
+        const std::size_t n_right = n - n_left;
+
+        double imp_left = count_impurity(n_left, sq_left, cl_left);
+        double imp_right = count_impurity(n_right, sq_right, cl_right);
+
+        double weighted = (n_left * imp_left + n_right * imp_right) / n;
+        double gain = parent_imp - weighted;
 
-    std::vector<std::size_t> indices(X.size());
-    std::iota(indices.begin(), indices.end(), 0);
+        if (gain > best.gain) {
+            best.gain = gain;
+            best.threshold = thresh;
+            best.position = k;
+        }
+    }
 
-    build_tree(X, y, indices, 0, *root_);
+    return best;
 }
 
 void DecisionTreeClassifier::build_tree(const std::vector<std::vector<double>>& X,
                                         const std::vector<double>& y,
-                                        const std::vector<std::size_t>& indices,
+                                        SortedColumns columns,
                                         std::size_t depth,
+                                        std::uint64_t seed,
                                         TreeNode& node) {
+    const std::vector<std::size_t>& indices = columns[0];
     std::size_t n = indices.size();
 
     if (depth >= max_depth_ || n < min_samples_split_ || n < 2 * min_samples_leaf_ || all_labels_same(y, indices)) {
@@ -147,63 +618,137 @@ void DecisionTreeClassifier::build_tree(const std::vector<std::vector<double>>&
         return;
     }
 
-    double best_gain = -std::numeric_limits<double>::infinity();
-    std::size_t best_feature = 0;
-    double best_threshold = 0.0;
-    std::vector<std::size_t> best_left, best_right;
+    std::vector<std::size_t> class_counts(code_to_label_.size(), 0);
+    for (std::size_t i : indices) ++class_counts[static_cast<std::size_t>(y[i])];
 
-    double parent_imp = (criterion_ == Criterion::gini) ? gini_impurity(y, indices) : entropy(y, indices);
+    double parent_imp = counts_impurity(class_counts, n);
 
-    for (std::size_t f = 0; f < X[0].size(); ++f) {
-        std::vector<std::pair<double, std::size_t>> sorted(indices.size());
-        for (std::size_t j = 0; j < n; ++j) {
-            std::size_t i = indices[j];
-            sorted[j] = {X[i][f], i};
+    const Split best = best_split(n, node_features(X[0].size(), seed), [&](std::size_t f) {
+        return feature_split(X, y, columns[f], f, parent_imp, class_counts);
+    });
+
+    if (best.gain < min_impurity_decrease_) {
+        make_leaf(node, y, indices);
+        return;
+    }
+
+    SortedColumns best_left, best_right;
+    partition_columns(columns, best, best_left, best_right);
+
+    node.is_leaf = false;
+    node.feature_index = best.feature;
+    node.threshold = best.threshold;
+    node.left = std::make_unique<TreeNode>();
+    node.right = std::make_unique<TreeNode>();
+
+    build_children(n, [&](std::size_t side) {
+        if (side == 0)
+            build_tree(X, y, std::move(best_left), depth + 1, mix_seed(seed, 0), *node.left);
+        else
+            build_tree(X, y, std::move(best_right), depth + 1, mix_seed(seed, 1), *node.right);
+    });
+}
+
+DecisionTree::Split DecisionTreeClassifier::binned_split(const std::vector<double>& hist,
+                                                         std::size_t f,
+                                                         std::size_t n,
+                                                         double parent_imp,
+                                                         const std::vector<std::size_t>& class_counts) const {
+    const std::size_t K = class_counts.size();
+    const double* h = &hist[bins_->offset(f) * K];
+    Split best;
+    best.feature = f;
+
+    std::vector<std::size_t> left(K, 0), right(class_counts);
+    std::size_t n_left = 0;
+
+    for (std::size_t b = 0; b + 1 < bins_->bins(f); ++b) {
+        std::size_t in_bin = 0;
+        for (std::size_t c = 0; c < K; ++c) {
+            const auto m = static_cast<std::size_t>(h[b * K + c]);
+            left[c] += m;
+            right[c] -= m;
+            in_bin += m;
         }
-        std::sort(sorted.begin(), sorted.end());
 
-        for (std::size_t k = min_samples_leaf_ - 1; k + min_samples_leaf_ < n; ++k) {
-            if (sorted[k].first == sorted[k + 1].first) continue;
-            double thresh = (sorted[k].first + sorted[k + 1].first) / 2.0;
+        // An empty bin repeats the previous partition.
+        if (in_bin == 0) continue;
+        n_left += in_bin;
 
-            std::vector<std::size_t> left_idx, right_idx;
-            left_idx.reserve(k + 1);
-            right_idx.reserve(n - k - 1);
+        if (n_left < min_samples_leaf_) continue;
+        if (n_left >= n || n - n_left < min_samples_leaf_) break;
 
-            for (std::size_t j = 0; j <= k; ++j)
-                left_idx.push_back(sorted[j].second);
-            for (std::size_t j = k + 1; j < n; ++j)
-                right_idx.push_back(sorted[j].second);
+        const std::size_t n_right = n - n_left;
 
-            double imp_left = (criterion_ == Criterion::gini) ? gini_impurity(y, left_idx) : entropy(y, left_idx);
-            double imp_right = (criterion_ == Criterion::gini) ? gini_impurity(y, right_idx) : entropy(y, right_idx);
+        double imp_left = counts_impurity(left, n_left);
+        double imp_right = counts_impurity(right, n_right);
 
-            double weighted = (left_idx.size() * imp_left + right_idx.size() * imp_right) / n;
-            double gain = parent_imp - weighted;
+        double weighted = (n_left * imp_left + n_right * imp_right) / n;
+        double gain = parent_imp - weighted;
 
-            if (gain > best_gain) {
-                best_gain = gain;
-                best_feature = f;
-                best_threshold = thresh;
-                best_left = std::move(left_idx);
-                best_right = std::move(right_idx);
-            }
+        if (gain > best.gain) {
+            best.gain = gain;
+            best.threshold = bins_->edge(f, b);
+            best.position = b;
         }
     }
 
-    if (best_gain < min_impurity_decrease_) {
+    return best;
+}
+
+void DecisionTreeClassifier::build_tree_binned(const std::vector<double>& y,
+                                               const std::vector<std::size_t>& indices,
+                                               std::size_t depth,
+                                               std::uint64_t seed,
+                                               TreeNode& node,
+                                               std::vector<double> hist) {
+    std::size_t n = indices.size();
+
+    if (hist.empty() || depth >= max_depth_ || n < min_samples_split_ || n < 2 * min_samples_leaf_ ||
+        all_labels_same(y, indices)) {
+        make_leaf(node, y, indices);
+        return;
+    }
+
+    // Every feature's bins partition the node; read the totals off feature 0.
+    const std::size_t K = code_to_label_.size();
+    std::vector<std::size_t> class_counts(K, 0);
+    for (std::size_t b = 0; b < bins_->bins(0); ++b)
+        for (std::size_t c = 0; c < K; ++c) class_counts[c] += static_cast<std::size_t>(hist[b * K + c]);
+
+    double parent_imp = counts_impurity(class_counts, n);
+
+    const Split best = best_split(n, node_features(bins_->features(), seed), [&](std::size_t f) {
+        return binned_split(hist, f, n, parent_imp, class_counts);
+    });
+
+    if (best.gain < min_impurity_decrease_) {
         make_leaf(node, y, indices);
         return;
     }
 
+    std::vector<std::size_t> best_left, best_right;
+    split_binned(indices, best, best_left, best_right);
+
+    std::vector<double> left_hist, right_hist;
+    if (depth + 1 < max_depth_) {
+        child_histograms(hist, best_left, best_right, K, [&](double* slot, std::size_t i) {
+            ++slot[static_cast<std::size_t>(y[i])];
+        }, left_hist, right_hist);
+    }
+
     node.is_leaf = false;
-    node.feature_index = best_feature;
-    node.threshold = best_threshold;
+    node.feature_index = best.feature;
+    node.threshold = best.threshold;
     node.left = std::make_unique<TreeNode>();
     node.right = std::make_unique<TreeNode>();
 
-    build_tree(X, y, best_left, depth + 1, *node.left);
-    build_tree(X, y, best_right, depth + 1, *node.right);
+    build_children(n, [&](std::size_t side) {
+        if (side == 0)
+            build_tree_binned(y, best_left, depth + 1, mix_seed(seed, 0), *node.left, std::move(left_hist));
+        else
+            build_tree_binned(y, best_right, depth + 1, mix_seed(seed, 1), *node.right, std::move(right_hist));
+    });
 }
 
 void DecisionTreeClassifier::make_leaf(TreeNode& node,
@@ -211,37 +756,29 @@ void DecisionTreeClassifier::make_leaf(TreeNode& node,
                                        const std::vector<std::size_t>& indices) {
     node.is_leaf = true;
     node.class_counts.assign(code_to_label_.size(), 0);
+    for (std::size_t i : indices) ++node.class_counts[static_cast<std::size_t>(y[i])];
 
-    std::unordered_map<double, std::size_t> count;
-    for (std::size_t i : indices) {
-        double label = y[i];
-        ++count[label];
-        ++node.class_counts[static_cast<std::size_t>(label)];
-    }
-
-    if (count.empty()) {
+    if (indices.empty()) {
         node.value = 0.0;
         return;
     }
 
-    auto it = std::max_element(count.begin(), count.end(),
-                               [](const auto& a, const auto& b) { return a.second < b.second; });
-    node.value = it->first;
+    // Majority class, the lowest code on ties, so the leaf does not depend
+    // on the order its rows arrive in.
+    auto it = std::max_element(node.class_counts.begin(), node.class_counts.end());
+    node.value = static_cast<double>(it - node.class_counts.begin());
     if (!code_to_label_.empty()) node.class_label = code_to_label_[static_cast<std::size_t>(node.value)];
 }
 
 double DecisionTreeClassifier::predict(const std::vector<double>& x) const {
-    if (!root_) throw std::runtime_error("Tree not fitted");
-    const TreeNode* n = root_.get();
-    while (!n->is_leaf) {
-        n = (x[n->feature_index] <= n->threshold) ? n->left.get() : n->right.get();
-    }
-    return n->value;
+    if (flat_.empty()) throw std::runtime_error("Tree not fitted");
+    return flat_.predict(x.data());
 }
 
 std::vector<double> DecisionTreeClassifier::predict(const std::vector<std::vector<double>>& X) const {
+    const std::vector<std::uint32_t> leaves = leaves_of(X.size(), [&](std::size_t r) { return X[r].data(); });
     std::vector<double> preds(X.size());
-    for (std::size_t i = 0; i < X.size(); ++i) preds[i] = predict(X[i]);
+    for (std::size_t i = 0; i < X.size(); ++i) preds[i] = flat_.leaf_value(leaves[i]);
     return preds;
 }
 
@@ -251,28 +788,28 @@ std::string DecisionTreeClassifier::predict_class(const std::vector<double>& x)
 }
 
 std::vector<std::string> DecisionTreeClassifier::predict_class(const std::vector<std::vector<double>>& X) const {
+    const std::vector<double> codes = predict(X);
     std::vector<std::string> preds(X.size());
-    for (std::size_t i = 0; i < X.size(); ++i) preds[i] = predict_class(X[i]);
+    for (std::size_t i = 0; i < X.size(); ++i) preds[i] = code_to_label_[static_cast<std::size_t>(codes[i])];
     return preds;
 }
 
 std::vector<double> DecisionTreeClassifier::predict_proba(const std::vector<double>& x) const {
-    if (!root_) throw std::runtime_error("Tree not fitted");
-    const TreeNode* n = root_.get();
-    while (!n->is_leaf) {
-        n = (x[n->feature_index] <= n->threshold) ? n->left.get() : n->right.get();
-    }
-    std::vector<double> proba(code_to_label_.size(), 0.0);
-    std::size_t total = 0;
-    for (std::size_t cnt : n->class_counts) total += cnt;
-    if (total == 0) {
-        proba[static_cast<std::size_t>(n->value)] = 1.0;
-    } else {
-        for (std::size_t i = 0; i < proba.size(); ++i) {
-            proba[i] = static_cast<double>(n->class_counts[i]) / total;
-        }
+    if (flat_.empty()) throw std::runtime_error("Tree not fitted");
+    const double* p = flat_.proba(x.data());
+    return std::vector<double>(p, p + flat_.n_classes());
+}
+
+void DecisionTreeClassifier::predict_proba_batch(const double* X,
+                                                 std::size_t rows,
+                                                 std::size_t cols,
+                                                 double* out) const {
+    const std::vector<std::uint32_t> leaves = leaves_of(rows, [&](std::size_t r) { return X + r * cols; });
+    const std::size_t K = flat_.n_classes();
+    for (std::size_t r = 0; r < rows; ++r) {
+        const double* p = flat_.leaf_proba(leaves[r]);
+        std::copy(p, p + K, out + r * K);
     }
-    return proba;
 }
 
 DecisionTreeRegressor::DecisionTreeRegressor(
@@ -280,18 +817,32 @@ DecisionTreeRegressor::DecisionTreeRegressor(
     std::size_t max_depth,
     std::size_t min_samples_split,
     std::size_t min_samples_leaf,
-    double min_impurity_decrease) {
+    double min_impurity_decrease,
+    std::size_t threads,
+    std::size_t max_bins,
+    std::size_t max_features,
+    std::uint64_t seed) {
     task_ = Task::regression;
     criterion_ = criterion;
     max_depth_ = max_depth;
     min_samples_split_ = min_samples_split;
     min_samples_leaf_ = min_samples_leaf;
     min_impurity_decrease_ = min_impurity_decrease;
+    threads_ = threads;
+    max_bins_ = max_bins;
+    max_features_ = max_features;
+    seed_ = seed;
     if (criterion_ == Criterion::friedman_mse) {
         throw std::invalid_argument("friedman_mse not implemented for basic regressor");
     } else if (criterion_ != Criterion::mse && criterion_ != Criterion::mae) {
         throw std::invalid_argument("Invalid criterion for regressor");
     }
+    if (max_bins_ != 0 && (max_bins_ < 2 || max_bins_ > FeatureBins::max_bins_limit)) {
+        throw std::invalid_argument("max_bins must be 0 or in [2, 256]");
+    }
+    if (max_bins_ != 0 && criterion_ == Criterion::mae) {
+        throw std::invalid_argument("Histogram splits support mse only");
+    }
 }
 
 void DecisionTreeRegressor::fit(const std::vector<std::vector<double>>& X,
@@ -301,22 +852,167 @@ void DecisionTreeRegressor::fit(const std::vector<std::vector<double>>& X,
 
 void DecisionTreeRegressor::fit(const std::vector<std::vector<double>>& X,
                                 const std::vector<double>& y) {
+    fit_rows(X, y, nullptr, nullptr);
+}
+
+void DecisionTreeRegressor::fit(const std::vector<std::vector<double>>& X,
+                                const std::vector<double>& y,
+                                const std::vector<std::size_t>& samples,
+                                const FeatureBins* bins) {
+    fit_rows(X, y, &samples, bins);
+}
+
+void DecisionTreeRegressor::fit_rows(const std::vector<std::vector<double>>& X,
+                                     const std::vector<double>& y,
+                                     const std::vector<std::size_t>* samples,
+                                     const FeatureBins* bins) {
     if (X.empty() || X.size() != y.size() || (not X.empty() and X[0].empty()))
         throw std::invalid_argument("Invalid input data");
+    if (bins && (bins->rows() != X.size() || bins->features() != X[0].size()))
+        throw std::invalid_argument("FeatureBins do not match X");
+
+    const std::vector<std::size_t> indices = fit_indices(X.size(), samples);
 
     root_ = std::make_unique<TreeNode>();
+    flat_ = FlatTree();
+
+    pool_ = &own_pool();
+
+    try {
+        if (max_bins_ == 0) {
+            goes_left_.assign(X.size(), 0);
+            build_tree(X, y, presort(X, indices), 0, seed_, *root_);
+        } else {
+            std::optional<FeatureBins> own;
+            if (!bins) bins = &own.emplace(X, max_bins_);
+            bins_ = bins;
+
+            // Histograms sum y about its mean, so split gains do not cancel.
+            double shift = 0.0;
+            for (std::size_t i : indices) shift += y[i];
+            shift /= indices.size();
+
+            std::vector<double> hist = histogram(indices, 2, [&](double* slot, std::size_t i) {
+                slot[0] += 1.0;
+                slot[1] += y[i] - shift;
+            });
+            build_tree_binned(y, shift, indices, 0, seed_, *root_, std::move(hist));
+        }
+    } catch (...) {
+        pool_ = nullptr;
+        bins_ = nullptr;
+        std::vector<std::uint8_t>().swap(goes_left_);
+        throw;
+    }
+    pool_ = nullptr;
+    bins_ = nullptr;
+    std::vector<std::uint8_t>().swap(goes_left_);
+
+    compile(layout_);
+}
+
+DecisionTree::Split DecisionTreeRegressor::feature_split(const std::vector<std::vector<double>>& X,
+                                                         const std::vector<double>& y,
+                                                         const std::vector<std::size_t>& sorted,
+                                                         std::size_t f,
+                                                         double parent_imp) const {
+    std::size_t n = sorted.size();
+    Split best;
+    best.feature = f;
+
+    if (criterion_ != Criterion::mae) {
+        // Var = E[y²] − E[y]², from running sums of the left side. y is
+        // shifted by the node mean so the difference does not cancel.
+        double shift = 0.0;
+        for (std::size_t i : sorted) shift += y[i];
+        shift /= n;
+
+        double sum = 0.0, sum_sq = 0.0;
+        for (std::size_t i : sorted) {
+            const double v = y[i] - shift;
+            sum += v;
+            sum_sq += v * v;
+        }
+
+        const auto var = [](double s, double s2, std::size_t m) {
+            if (m <= 1) return 0.0;
+            const double mean = s / m;
+            return std::max(0.0, s2 / m - mean * mean);
+        };
+
+        double sum_left = 0.0, sq_left = 0.0;
+        double value = n != 0 ? X[sorted[0]][f] : 0.0;
+
+        for (std::size_t k = 0; k + 1 < n; ++k) {
+            const double next = X[sorted[k + 1]][f];
+            const double current = std::exchange(value, next);
+
+            const double v = y[sorted[k]] - shift;
+            sum_left += v;
+            sq_left += v * v;
+
+            if (k + 1 < min_samples_leaf_) continue;
+            if (k + min_samples_leaf_ >= n) break;
+            if (current == next) continue;
+            double thresh = (current + next) / 2.0;
+
+            const std::size_t n_left = k + 1;
+            const std::size_t n_right = n - n_left;
+
+            double imp_left = var(sum_left, sq_left, n_left);
+            double imp_right = var(sum - sum_left, sum_sq - sq_left, n_right);
+
+            double weighted = (n_left * imp_left + n_right * imp_right) / n;
+            double gain = parent_imp - weighted;
+
+            if (gain > best.gain) {
+                best.gain = gain;
+                best.threshold = thresh;
+                best.position = k;
+            }
+        }
+
+        return best;
+    }
 
-    std::vector<std::size_t> indices(X.size());
-    std::iota(indices.begin(), indices.end(), 0);
+    for (std::size_t k = min_samples_leaf_ - 1; k + min_samples_leaf_ < n; ++k) {
+        const double current = X[sorted[k]][f];
+        const double next = X[sorted[k + 1]][f];
+        if (current == next) continue;
+        double thresh = (current + next) / 2.0;
 
-    build_tree(X, y, indices, 0, *root_);
+        std::vector<std::size_t> left_idx, right_idx;
+        left_idx.reserve(k + 1);
+        right_idx.reserve(n - k - 1);
+
+        for (std::size_t j = 0; j <= k; ++j)
+            left_idx.push_back(sorted[j]);
+        for (std::size_t j = k + 1; j < n; ++j)
+            right_idx.push_back(sorted[j]);
+
+        double imp_left = mean_absolute_deviation(y, left_idx);
+        double imp_right = mean_absolute_deviation(y, right_idx);
+
+        double weighted = (left_idx.size() * imp_left + right_idx.size() * imp_right) / n;
+        double gain = parent_imp - weighted;
+
+        if (gain > best.gain) {
+            best.gain = gain;
+            best.threshold = thresh;
+            best.position = k;
+        }
+    }
+
+    return best;
 }
 
 void DecisionTreeRegressor::build_tree(const std::vector<std::vector<double>>& X,
                                        const std::vector<double>& y,
-                                       const std::vector<std::size_t>& indices,
+                                       SortedColumns columns,
                                        std::size_t depth,
+                                       std::uint64_t seed,
                                        TreeNode& node) {
+    const std::vector<std::size_t>& indices = columns[0];
     std::size_t n = indices.size();
 
     if (depth >= max_depth_ || n < min_samples_split_ || n < 2 * min_samples_leaf_) {
@@ -324,66 +1020,269 @@ void DecisionTreeRegressor::build_tree(const std::vector<std::vector<double>>& X
         return;
     }
 
-    double best_gain = -std::numeric_limits<double>::infinity();
-    std::size_t best_feature = 0;
-    double best_threshold = 0.0;
-    std::vector<std::size_t> best_left, best_right;
+    double parent_imp = (criterion_ == Criterion::mae) ? mean_absolute_deviation(y, indices)
+                                                        : variance(y, indices);
 
-    double (*imp_func)(const std::vector<double>&, const std::vector<std::size_t>&) =
-        (criterion_ == Criterion::mae) ? mean_absolute_deviation : variance;
+    const Split best = best_split(n, node_features(X[0].size(), seed), [&](std::size_t f) {
+        return feature_split(X, y, columns[f], f, parent_imp);
+    });
 
-    double parent_imp = imp_func(y, indices);
+    if (best.gain < min_impurity_decrease_) {
+        make_leaf(node, y, indices);
+        return;
+    }
 
-    for (std::size_t f = 0; f < X[0].size(); ++f) {
-        std::vector<std::pair<double, std::size_t>> sorted(indices.size());
-        for (std::size_t j = 0; j < n; ++j) {
-            std::size_t i = indices[j];
-            sorted[j] = {X[i][f], i};
-        }
-        std::sort(sorted.begin(), sorted.end());
+    SortedColumns best_left, best_right;
+    partition_columns(columns, best, best_left, best_right);
 
-        for (std::size_t k = min_samples_leaf_ - 1; k + min_samples_leaf_ < n; ++k) {
-            if (sorted[k].first == sorted[k + 1].first) continue;
-            double thresh = (sorted[k].first + sorted[k + 1].first) / 2.0;
+    node.is_leaf = false;
+    node.feature_index = best.feature;
+    node.threshold = best.threshold;
+    node.left = std::make_unique<TreeNode>();
+    node.right = std::make_unique<TreeNode>();
 
-            std::vector<std::size_t> left_idx, right_idx;
-            left_idx.reserve(k + 1);
-            right_idx.reserve(n - k - 1);
+    build_children(n, [&](std::size_t side) {
+        if (side == 0)
+            build_tree(X, y, std::move(best_left), depth + 1, mix_seed(seed, 0), *node.left);
+        else
+            build_tree(X, y, std::move(best_right), depth + 1, mix_seed(seed, 1), *node.right);
+    });
+}
 
-            for (std::size_t j = 0; j <= k; ++j)
-                left_idx.push_back(sorted[j].second);
-            for (std::size_t j = k + 1; j < n; ++j)
-                right_idx.push_back(sorted[j].second);
+DecisionTree::Split DecisionTreeRegressor::binned_split(const std::vector<double>& hist,
+                                                        std::size_t f,
+                                                        std::size_t n,
+                                                        double sum) const {
+    const double* h = &hist[bins_->offset(f) * 2];
+    const double mean = sum / n;
+    Split best;
+    best.feature = f;
 
-            double imp_left = imp_func(y, left_idx);
-            double imp_right = imp_func(y, right_idx);
+    std::size_t n_left = 0;
+    double sum_left = 0.0;
 
-            double weighted = (left_idx.size() * imp_left + right_idx.size() * imp_right) / n;
-            double gain = parent_imp - weighted;
+    for (std::size_t b = 0; b + 1 < bins_->bins(f); ++b) {
+        const auto in_bin = static_cast<std::size_t>(h[2 * b]);
 
-            if (gain > best_gain) {
-                best_gain = gain;
-                best_feature = f;
-                best_threshold = thresh;
-                best_left = std::move(left_idx);
-                best_right = std::move(right_idx);
-            }
+        // An empty bin repeats the previous partition.
+        if (in_bin == 0) continue;
+        n_left += in_bin;
+        sum_left += h[2 * b + 1];
+
+        if (n_left < min_samples_leaf_) continue;
+        if (n_left >= n || n - n_left < min_samples_leaf_) break;
+
+        const std::size_t n_right = n - n_left;
+
+        // Var(parent) − (n_l Var(left) + n_r Var(right)) / n
+        //   = (S_l − n_l ȳ)² / (n_l n_r)
+        double d = sum_left - n_left * mean;
+        double gain = d * d / (static_cast<double>(n_left) * n_right);
+
+        if (gain > best.gain) {
+            best.gain = gain;
+            best.threshold = bins_->edge(f, b);
+            best.position = b;
         }
     }
 
-    if (best_gain < min_impurity_decrease_) {
+    return best;
+}
+
+void DecisionTreeRegressor::build_tree_binned(const std::vector<double>& y,
+                                              double shift,
+                                              const std::vector<std::size_t>& indices,
+                                              std::size_t depth,
+                                              std::uint64_t seed,
+                                              TreeNode& node,
+                                              std::vector<double> hist) {
+    std::size_t n = indices.size();
+
+    if (hist.empty() || depth >= max_depth_ || n < min_samples_split_ || n < 2 * min_samples_leaf_) {
+        make_leaf(node, y, indices);
+        return;
+    }
+
+    double sum = 0.0;
+    for (std::size_t b = 0; b < bins_->bins(0); ++b) sum += hist[2 * b + 1];
+
+    const Split best = best_split(n, node_features(bins_->features(), seed), [&](std::size_t f) {
+        return binned_split(hist, f, n, sum);
+    });
+
+    if (best.gain < min_impurity_decrease_) {
         make_leaf(node, y, indices);
         return;
     }
 
+    std::vector<std::size_t> best_left, best_right;
+    split_binned(indices, best, best_left, best_right);
+
+    std::vector<double> left_hist, right_hist;
+    if (depth + 1 < max_depth_) {
+        child_histograms(hist, best_left, best_right, 2, [&](double* slot, std::size_t i) {
+            slot[0] += 1.0;
+            slot[1] += y[i] - shift;
+        }, left_hist, right_hist);
+    }
+
+    node.is_leaf = false;
+    node.feature_index = best.feature;
+    node.threshold = best.threshold;
+    node.left = std::make_unique<TreeNode>();
+    node.right = std::make_unique<TreeNode>();
+
+    build_children(n, [&](std::size_t side) {
+        if (side == 0)
+            build_tree_binned(y, shift, best_left, depth + 1, mix_seed(seed, 0), *node.left,
+                              std::move(left_hist));
+        else
+            build_tree_binned(y, shift, best_right, depth + 1, mix_seed(seed, 1), *node.right,
+                              std::move(right_hist));
+    });
+}
+
+void DecisionTreeRegressor::fit_gradients(const FeatureBins& bins,
+                                          const std::vector<double>& gradients,
+                                          const std::vector<double>& hessians,
+                                          const std::vector<std::size_t>& samples,
+                                          double lambda) {
+    fit_gradients(bins, gradients, hessians, samples, lambda, own_pool());
+}
+
+void DecisionTreeRegressor::fit_gradients(const FeatureBins& bins,
+                                          const std::vector<double>& gradients,
+                                          const std::vector<double>& hessians,
+                                          const std::vector<std::size_t>& samples,
+                                          double lambda,
+                                          mlpp::parallel::ThreadPool& pool) {
+    if (gradients.size() != bins.rows() || hessians.size() != bins.rows())
+        throw std::invalid_argument("Gradients do not match FeatureBins");
+    if (!(lambda >= 0.0)) throw std::invalid_argument("lambda must be non-negative");
+
+    const std::vector<std::size_t> indices = fit_indices(bins.rows(), &samples);
+    const Gradients grad{gradients, hessians, lambda};
+
+    root_ = std::make_unique<TreeNode>();
+    flat_ = FlatTree();
+
+    pool_ = &pool;
+    bins_ = &bins;
+
+    try {
+        std::vector<double> hist = histogram(indices, 3, [&](double* slot, std::size_t i) {
+            slot[0] += 1.0;
+            slot[1] += gradients[i];
+            slot[2] += hessians[i];
+        });
+        build_tree_gradients(grad, indices, 0, seed_, *root_, std::move(hist));
+    } catch (...) {
+        pool_ = nullptr;
+        bins_ = nullptr;
+        throw;
+    }
+    pool_ = nullptr;
+    bins_ = nullptr;
+
+    compile(layout_);
+}
+
+DecisionTree::Split DecisionTreeRegressor::gradient_split(const std::vector<double>& hist,
+                                                          std::size_t f,
+                                                          std::size_t n,
+                                                          double G,
+                                                          double H,
+                                                          double lambda) const {
+    const double* h = &hist[bins_->offset(f) * 3];
+    const double parent = G * G / (H + lambda);
+    Split best;
+    best.feature = f;
+
+    std::size_t n_left = 0;
+    double g_left = 0.0, h_left = 0.0;
+
+    for (std::size_t b = 0; b + 1 < bins_->bins(f); ++b) {
+        const auto in_bin = static_cast<std::size_t>(h[3 * b]);
+
+        // An empty bin repeats the previous partition.
+        if (in_bin == 0) continue;
+        n_left += in_bin;
+        g_left += h[3 * b + 1];
+        h_left += h[3 * b + 2];
+
+        if (n_left < min_samples_leaf_) continue;
+        if (n_left >= n || n - n_left < min_samples_leaf_) break;
+
+        const double g_right = G - g_left;
+        const double h_right = H - h_left;
+        if (h_left + lambda <= 0.0 || h_right + lambda <= 0.0) continue;
+
+        double gain = 0.5 * (g_left * g_left / (h_left + lambda) +
+                             g_right * g_right / (h_right + lambda) - parent);
+
+        if (gain > best.gain) {
+            best.gain = gain;
+            best.threshold = bins_->edge(f, b);
+            best.position = b;
+        }
+    }
+
+    return best;
+}
+
+void DecisionTreeRegressor::build_tree_gradients(const Gradients& grad,
+                                                 const std::vector<std::size_t>& indices,
+                                                 std::size_t depth,
+                                                 std::uint64_t seed,
+                                                 TreeNode& node,
+                                                 std::vector<double> hist) {
+    std::size_t n = indices.size();
+
+    double G = 0.0, H = 0.0;
+    for (std::size_t i : indices) {
+        G += grad.g[i];
+        H += grad.h[i];
+    }
+
+    node.is_leaf = true;
+    node.value = H + grad.lambda > 0.0 ? -G / (H + grad.lambda) : 0.0;
+
+    if (hist.empty() || depth >= max_depth_ || n < min_samples_split_ || n < 2 * min_samples_leaf_) return;
+    if (H + grad.lambda <= 0.0) return;
+
+    const Split best = best_split(n, node_features(bins_->features(), seed), [&](std::size_t f) {
+        return gradient_split(hist, f, n, G, H, grad.lambda);
+    });
+
+    if (best.gain < min_impurity_decrease_) return;
+
+    std::vector<std::size_t> best_left, best_right;
+    split_binned(indices, best, best_left, best_right);
+
+    std::vector<double> left_hist, right_hist;
+    if (depth + 1 < max_depth_) {
+        child_histograms(hist, best_left, best_right, 3, [&](double* slot, std::size_t i) {
+            slot[0] += 1.0;
+            slot[1] += grad.g[i];
+            slot[2] += grad.h[i];
+        }, left_hist, right_hist);
+    }
+
     node.is_leaf = false;
-    node.feature_index = best_feature;
-    node.threshold = best_threshold;
+    node.value = 0.0;
+    node.feature_index = best.feature;
+    node.threshold = best.threshold;
     node.left = std::make_unique<TreeNode>();
     node.right = std::make_unique<TreeNode>();
 
-    build_tree(X, y, best_left, depth + 1, *node.left);
-    build_tree(X, y, best_right, depth + 1, *node.right);
+    build_children(n, [&](std::size_t side) {
+        if (side == 0)
+            build_tree_gradients(grad, best_left, depth + 1, mix_seed(seed, 0), *node.left,
+                                 std::move(left_hist));
+        else
+            build_tree_gradients(grad, best_right, depth + 1, mix_seed(seed, 1), *node.right,
+                                 std::move(right_hist));
+    });
 }
 
 void DecisionTreeRegressor::make_leaf(TreeNode& node,
@@ -400,17 +1299,14 @@ void DecisionTreeRegressor::make_leaf(TreeNode& node,
 }
 
 double DecisionTreeRegressor::predict(const std::vector<double>& x) const {
-    if (!root_) throw std::runtime_error("Tree not fitted");
-    const TreeNode* n = root_.get();
-    while (!n->is_leaf) {
-        n = (x[n->feature_index] <= n->threshold) ? n->left.get() : n->right.get();
-    }
-    return n->value;
+    if (flat_.empty()) throw std::runtime_error("Tree not fitted");
+    return flat_.predict(x.data());
 }
 
 std::vector<double> DecisionTreeRegressor::predict(const std::vector<std::vector<double>>& X) const {
+    const std::vector<std::uint32_t> leaves = leaves_of(X.size(), [&](std::size_t r) { return X[r].data(); });
     std::vector<double> preds(X.size());
-    for (std::size_t i = 0; i < X.size(); ++i) preds[i] = predict(X[i]);
+    for (std::size_t i = 0; i < X.size(); ++i) preds[i] = flat_.leaf_value(leaves[i]);
     return preds;
 }
 
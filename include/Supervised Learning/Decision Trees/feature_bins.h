@@ -0,0 +1,94 @@
+// feature_bins.h
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <stdexcept>
+
+namespace decision_trees {
+
+// Features quantised once into at most 256 bins per feature, for
+// histogram-based split search.
+//
+// Bin b of feature f holds the values in (edge(f, b - 1), edge(f, b)],
+// so "bin <= b" is the same test as "x <= edge(f, b)" and a split found
+// on bins is stored as an ordinary threshold. A feature with at most
+// max_bins distinct values gets one bin per value and edges halfway
+// between them, i.e. exactly the thresholds the exact search tries.
+// Otherwise edges are placed at quantiles of the training values.
+//
+// Codes are stored column-major: column(f) is n contiguous bytes, which
+// is what accumulating a histogram one feature at a time reads.
+class FeatureBins {
+public:
+    static constexpr std::size_t max_bins_limit = 256;
+
+    FeatureBins() = default;
+
+    FeatureBins(const std::vector<std::vector<double>>& X, std::size_t max_bins = max_bins_limit) {
+        if (max_bins < 2 || max_bins > max_bins_limit)
+            throw std::invalid_argument("max_bins must be in [2, 256]");
+        if (X.empty() || X[0].empty()) throw std::invalid_argument("Invalid input data");
+
+        rows_ = X.size();
+        features_ = X[0].size();
+        codes_.resize(rows_ * features_);
+        edges_.resize(features_);
+        offsets_.resize(features_ + 1, 0);
+
+        std::vector<double> values(rows_);
+        for (std::size_t f = 0; f < features_; ++f) {
+            for (std::size_t i = 0; i < rows_; ++i) values[i] = X[i][f];
+            std::sort(values.begin(), values.end());
+
+            std::vector<double>& edges = edges_[f];
+            std::size_t distinct = 1;
+            for (std::size_t i = 1; i < rows_; ++i) distinct += values[i] != values[i - 1];
+
+            // Cut between two distinct neighbours: always when every value
+            // has its own bin, otherwise once a quantile's worth has passed.
+            for (std::size_t i = 1; i < rows_; ++i) {
+                if (values[i] == values[i - 1]) continue;
+                if (distinct > max_bins && i * max_bins < (edges.size() + 1) * rows_) continue;
+                edges.push_back((values[i - 1] + values[i]) / 2.0);
+                if (edges.size() + 1 == max_bins) break;
+            }
+
+            offsets_[f + 1] = offsets_[f] + edges.size() + 1;
+
+            std::uint8_t* col = &codes_[f * rows_];
+            for (std::size_t i = 0; i < rows_; ++i) col[i] = bin(f, X[i][f]);
+        }
+    }
+
+    std::size_t rows() const noexcept { return rows_; }
+    std::size_t features() const noexcept { return features_; }
+
+    // Number of bins of feature f, and the first slot of f when the bins
+    // of all features are laid out one after another.
+    std::size_t bins(std::size_t f) const noexcept { return edges_[f].size() + 1; }
+    std::size_t offset(std::size_t f) const noexcept { return offsets_[f]; }
+    std::size_t total_bins() const noexcept { return offsets_[features_]; }
+
+    const std::uint8_t* column(std::size_t f) const noexcept { return &codes_[f * rows_]; }
+
+    // Upper edge of bin b; valid for b < bins(f) - 1.
+    double edge(std::size_t f, std::size_t b) const noexcept { return edges_[f][b]; }
+
+    // Bin of value x of feature f.
+    std::uint8_t bin(std::size_t f, double x) const noexcept {
+        const std::vector<double>& edges = edges_[f];
+        return static_cast<std::uint8_t>(std::lower_bound(edges.begin(), edges.end(), x) - edges.begin());
+    }
+
+private:
+    std::size_t rows_{0};
+    std::size_t features_{0};
+    std::vector<std::uint8_t> codes_;         // rows_ × features_, column-major
+    std::vector<std::vector<double>> edges_;  // bins(f) - 1 ascending edges per feature
+    std::vector<std::size_t> offsets_;
+};
+
+}  // namespace decision_trees
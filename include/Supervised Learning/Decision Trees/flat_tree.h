@@ -0,0 +1,192 @@
+// flat_tree.h
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <algorithm>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace decision_trees {
+
+struct TreeNode;
+
+// Order in which FlatTree stores its nodes.
+//  - breadth_first: level by level; the top levels share a few cache lines.
+//  - van_emde_boas: recursively, a top half of the levels followed by each
+//    bottom subtree, so any root-to-leaf path touches O(log_B n) lines.
+enum class FlatLayout { breadth_first, van_emde_boas };
+
+// A fitted tree compiled into one contiguous array for inference.
+//
+// Every node is 16 bytes: the threshold, the feature index and the index
+// of its left child. The right child always follows the left one, so one
+// index serves both, and four nodes fit a 64-byte cache line. Leaves are
+// marked by feature == leaf; their threshold slot holds the predicted
+// value and child indexes the class probabilities, which live in a
+// separate array (n_classes per leaf) so they never dilute the nodes.
+class FlatTree {
+public:
+    struct Node {
+        double threshold;
+        std::uint32_t feature;
+        std::uint32_t child;
+    };
+
+    static constexpr std::uint32_t leaf = std::numeric_limits<std::uint32_t>::max();
+
+    // Rows advanced together by leaves_of().
+    static constexpr std::size_t block_rows = 32;
+
+    FlatTree() = default;
+
+    // n_classes is 0 for regression trees, which then carry no probabilities.
+    FlatTree(const TreeNode& root,
+             std::size_t n_classes,
+             FlatLayout layout = FlatLayout::breadth_first);
+
+    bool empty() const noexcept { return nodes_.empty(); }
+    std::size_t size() const noexcept { return nodes_.size(); }
+    std::size_t n_classes() const noexcept { return n_classes_; }
+    FlatLayout layout() const noexcept { return layout_; }
+    const std::vector<Node>& nodes() const noexcept { return nodes_; }
+
+    // Longest root-to-leaf path, in edges.
+    std::size_t depth() const noexcept { return depth_; }
+
+    // Node index of the leaf that x falls into.
+    std::size_t leaf_of(const double* x) const noexcept {
+        std::uint32_t i = 0;
+        while (nodes_[i].feature != leaf) {
+            const Node& node = nodes_[i];
+            i = node.child + !(x[node.feature] <= node.threshold);
+        }
+        return i;
+    }
+
+    double predict(const double* x) const noexcept { return nodes_[leaf_of(x)].threshold; }
+
+    // n_classes() probabilities of the leaf that x falls into.
+    const double* proba(const double* x) const noexcept { return leaf_proba(leaf_of(x)); }
+
+    // Prediction and probabilities stored at leaf node i.
+    double leaf_value(std::size_t i) const noexcept { return nodes_[i].threshold; }
+    const double* leaf_proba(std::size_t i) const noexcept { return &probabilities_[nodes_[i].child * n_classes_]; }
+
+    // Leaf node index of count rows into out; row(r) returns a pointer to
+    // the features of row r.
+    //
+    // A single traversal is a chain of dependent loads. Here block_rows
+    // rows descend together, one level per pass over the block, so the
+    // loads of different rows are independent and overlap. With AVX2 the
+    // pass handles four rows per step with gathers and one vector
+    // comparison.
+    template <typename Row>
+    void leaves_of(std::size_t count, Row&& row, std::uint32_t* out) const noexcept;
+
+private:
+    // The layout is built over units that are stored contiguously: the
+    // root alone, then each pair of siblings.
+    struct Unit {
+        const TreeNode* node[2]{nullptr, nullptr};
+        std::size_t count{0};
+        std::size_t child[2]{0, 0};  // unit holding the children of node[k]
+        std::size_t height{1};        // levels of units in this subtree
+    };
+
+    // Append the units of the subtree at u, cut to height levels, in
+    // van Emde Boas order.
+    static void van_emde_boas(const std::vector<Unit>& units,
+                              std::size_t u,
+                              std::size_t height,
+                              std::vector<std::size_t>& order);
+
+    // Move each of the m rows in x one level down from node idx[r];
+    // false once every row sits at a leaf.
+    bool advance(const double* const* x, std::uint32_t* idx, std::size_t m) const noexcept;
+
+    std::vector<Node> nodes_;
+    std::vector<double> probabilities_;
+    std::size_t n_classes_{0};
+    std::size_t depth_{0};
+    FlatLayout layout_{FlatLayout::breadth_first};
+};
+
+template <typename Row>
+void FlatTree::leaves_of(std::size_t count, Row&& row, std::uint32_t* out) const noexcept {
+    const double* x[block_rows];
+
+    for (std::size_t first = 0; first < count; first += block_rows) {
+        const std::size_t m = std::min(block_rows, count - first);
+        std::uint32_t* idx = out + first;
+
+        for (std::size_t r = 0; r < m; ++r) {
+            x[r] = row(first + r);
+            idx[r] = 0;
+        }
+
+        for (std::size_t level = 0; level < depth_ && advance(x, idx, m); ++level) {}
+    }
+}
+
+inline bool FlatTree::advance(const double* const* x, std::uint32_t* idx, std::size_t m) const noexcept {
+    std::size_t r = 0;
+    bool moved = false;
+
+#if defined(__AVX2__)
+    static_assert(sizeof(const double*) == sizeof(std::int64_t));
+
+    // Node i is the four 32-bit words 4i .. 4i + 3: threshold, feature, child.
+    const int* words = reinterpret_cast<const int*>(nodes_.data());
+    const double* thresholds = reinterpret_cast<const double*>(nodes_.data());
+
+    // Masked gathers with an explicit source; all lanes are loaded.
+    const __m128i all = _mm_set1_epi32(-1);
+    const __m256d all_pd = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+
+    for (; r + 4 <= m; r += 4) {
+        const __m128i i = _mm_loadu_si128(reinterpret_cast<const __m128i*>(idx + r));
+        const __m128i word = _mm_slli_epi32(i, 2);
+
+        const __m128i feature =
+            _mm_mask_i32gather_epi32(all, words, _mm_add_epi32(word, _mm_set1_epi32(2)), all, 4);
+        const __m128i child =
+            _mm_mask_i32gather_epi32(all, words, _mm_add_epi32(word, _mm_set1_epi32(3)), all, 4);
+        const __m256d threshold =
+            _mm256_mask_i32gather_pd(all_pd, thresholds, _mm_slli_epi32(i, 1), all_pd, 8);
+        const __m128i is_leaf = _mm_cmpeq_epi32(feature, all);
+
+        if (_mm_movemask_ps(_mm_castsi128_ps(is_leaf)) == 0xF) continue;
+        moved = true;
+
+        // Byte offsets of x[r + k][feature_k] from x[r]; leaves read feature 0.
+        const __m256i rows = _mm256_sub_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + r)),
+                                              _mm256_set1_epi64x(reinterpret_cast<std::int64_t>(x[r])));
+        const __m256i column = _mm256_slli_epi64(_mm256_cvtepu32_epi64(_mm_andnot_si128(is_leaf, feature)), 3);
+        const __m256d value = _mm256_mask_i64gather_pd(all_pd, x[r], _mm256_add_epi64(rows, column), all_pd, 1);
+
+        // Go right unless x <= threshold (so NaN goes right, as in leaf_of):
+        // the 64-bit masks narrowed to 32 bits are -1 to stay left.
+        const __m256i le = _mm256_castpd_si256(_mm256_cmp_pd(value, threshold, _CMP_LE_OQ));
+        const __m128i le32 = _mm256_castsi256_si128(
+            _mm256_permutevar8x32_epi32(le, _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6)));
+        const __m128i next = _mm_add_epi32(child, _mm_sub_epi32(le32, all));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(idx + r), _mm_blendv_epi8(next, i, is_leaf));
+    }
+#endif
+
+    for (; r < m; ++r) {
+        const Node& node = nodes_[idx[r]];
+        if (node.feature == leaf) continue;
+        idx[r] = node.child + !(x[r][node.feature] <= node.threshold);
+        moved = true;
+    }
+    return moved;
+}
+
+}  // namespace decision_trees
@@ -0,0 +1,188 @@
+// gradient_boosting.h
+#pragma once
+
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+
+#include "decision_tree.h"
+
+namespace decision_trees {
+
+struct GradientBoostingOptions {
+    std::size_t n_estimators = 100;  // boosting rounds
+    double learning_rate = 0.1;      // shrinkage applied to every tree
+
+    // Growth limits of every tree, see DecisionTree.
+    std::size_t max_depth = 6;
+    std::size_t min_samples_leaf = 20;
+
+    // Loss reduction a split must reach, and L2 penalty on leaf values.
+    double min_split_gain = 0.0;
+    double lambda = 1.0;
+
+    // Fraction of the rows each round is fit on, drawn without replacement,
+    // and of the features tried at each split.
+    double subsample = 1.0;
+    double colsample = 1.0;
+
+    // Bins per feature; the features are binned once for all rounds.
+    std::size_t max_bins = 256;
+
+    // With a validation set, stop once its loss has not improved for this
+    // many rounds and keep the rounds up to the best one (0 = never stop).
+    std::size_t early_stopping_rounds = 10;
+
+    std::size_t threads = 0;  // 0 = all hardware threads
+    std::uint64_t seed = 0;
+};
+
+// Gradient-boosted trees.
+//
+// Each round fits one DecisionTreeRegressor per output to the gradients
+// and hessians of the loss at the current raw scores (a Newton step, see
+// DecisionTreeRegressor::fit_gradients) and adds it, scaled by the
+// learning rate. The features are quantised into FeatureBins once, and
+// every tree of every round builds its histograms from those codes, so a
+// round costs a pass over the sampled rows per tree level rather than a
+// sort. The raw scores of the training rows, and of the validation rows
+// if any, are kept up to date tree by tree, so evaluating a round never
+// re-runs the earlier trees.
+//
+// Everything random comes from per-round seeds, so a model does not depend
+// on the thread count.
+class GradientBoosting {
+public:
+    // Rounds kept after fit().
+    std::size_t n_rounds() const noexcept { return outputs_ == 0 ? 0 : trees_.size() / outputs_; }
+
+    // Validation loss after each round fitted; empty without a validation set.
+    const std::vector<double>& validation_loss() const noexcept { return validation_loss_; }
+
+    // Tree of round r for output k at r * outputs + k.
+    const std::vector<DecisionTreeRegressor>& trees() const noexcept { return trees_; }
+
+protected:
+    explicit GradientBoosting(GradientBoostingOptions options);
+
+    using Matrix = std::vector<std::vector<double>>;
+
+    // Fit outputs trees per round, starting from the raw scores base.
+    // gradient(i, F, g, h) sets g[k][i] and h[k][i] for training row i
+    // from its raw scores F[0 .. outputs); loss(F_val) is the loss of the
+    // validation raw scores (rows × outputs, row-major).
+    template <typename Gradient, typename Loss>
+    void boost(const Matrix& X,
+               std::size_t outputs,
+               std::vector<double> base,
+               Gradient&& gradient,
+               const Matrix* X_val,
+               Loss&& loss);
+
+    // Raw scores of count rows into out (count × outputs).
+    template <typename Row>
+    void raw_scores(std::size_t count, Row&& row, double* out) const;
+
+    GradientBoostingOptions options_;
+    std::size_t outputs_{0};
+    std::vector<double> base_score_;
+    std::vector<DecisionTreeRegressor> trees_;
+    std::vector<double> validation_loss_;
+
+    // Pool of options_.threads threads, created by the first fit() and
+    // shared by every tree it grows and by prediction.
+    std::shared_ptr<mlpp::parallel::ThreadPool> pool_;
+};
+
+// Squared-error regression.
+class GradientBoostingRegressor : public GradientBoosting {
+public:
+    explicit GradientBoostingRegressor(GradientBoostingOptions options = {});
+
+    void fit(const std::vector<std::vector<double>>& X,
+             const std::vector<double>& y);
+
+    // Fit with early stopping on the mean squared error of (X_val, y_val).
+    void fit(const std::vector<std::vector<double>>& X,
+             const std::vector<double>& y,
+             const std::vector<std::vector<double>>& X_val,
+             const std::vector<double>& y_val);
+
+    double predict(const std::vector<double>& x) const;
+    std::vector<double> predict(const std::vector<std::vector<double>>& X) const;
+
+    // Predictions of rows samples stored row-major, cols values per row,
+    // written to out.
+    void predict_batch(const double* X, std::size_t rows, std::size_t cols, double* out) const;
+
+private:
+    void fit_rows(const std::vector<std::vector<double>>& X,
+                  const std::vector<double>& y,
+                  const std::vector<std::vector<double>>* X_val,
+                  const std::vector<double>* y_val);
+};
+
+// Log-loss classification: a logistic model with one tree per round for
+// two classes, a softmax with one tree per class and round otherwise.
+class GradientBoostingClassifier : public GradientBoosting {
+public:
+    explicit GradientBoostingClassifier(GradientBoostingOptions options = {});
+
+    void fit(const std::vector<std::vector<double>>& X,
+             const std::vector<std::string>& y);
+
+    // Fit with early stopping on the cross-entropy of (X_val, y_val).
+    void fit(const std::vector<std::vector<double>>& X,
+             const std::vector<std::string>& y,
+             const std::vector<std::vector<double>>& X_val,
+             const std::vector<std::string>& y_val);
+
+    // y holds class codes: non-negative integers, named "0", "1", ...
+    void fit(const std::vector<std::vector<double>>& X,
+             const std::vector<double>& y);
+
+    void fit(const std::vector<std::vector<double>>& X,
+             const std::vector<double>& y,
+             const std::vector<std::vector<double>>& X_val,
+             const std::vector<double>& y_val);
+
+    // Class code with the highest probability.
+    double predict(const std::vector<double>& x) const;
+    std::vector<double> predict(const std::vector<std::vector<double>>& X) const;
+
+    std::string predict_class(const std::vector<double>& x) const;
+    std::vector<std::string> predict_class(const std::vector<std::vector<double>>& X) const;
+
+    std::vector<double> predict_proba(const std::vector<double>& x) const;
+
+    // Probabilities of rows samples stored row-major, cols values per row,
+    // written to out as rows × classes().size().
+    void predict_proba_batch(const double* X, std::size_t rows, std::size_t cols, double* out) const;
+
+    // Class codes of rows samples stored row-major, written to out.
+    void predict_batch(const double* X, std::size_t rows, std::size_t cols, double* out) const;
+
+    const std::vector<std::string>& classes() const noexcept { return code_to_label_; }
+
+private:
+    // Codes of labels of the fitted classes; throws on an unknown label.
+    std::vector<double> codes_of(const std::vector<std::string>& y) const;
+
+    // Fit on y holding class codes 0 .. classes().size() - 1.
+    void fit_codes(const std::vector<std::vector<double>>& X,
+                   const std::vector<double>& y,
+                   const std::vector<std::vector<double>>* X_val,
+                   const std::vector<double>* y_val);
+
+    // Probabilities of count rows into out (count × classes().size()).
+    template <typename Row>
+    void probabilities(std::size_t count, Row&& row, double* out) const;
+
+    std::vector<std::string> code_to_label_;
+    std::unordered_map<std::string, double> label_to_code_;
+};
+
+}  // namespace decision_trees
@@ -0,0 +1,434 @@
+// gradient_boosting.inl
+
+#include "gradient_boosting.h"
+#include "Losses/loss_functions.hpp"
+
+namespace decision_trees {
+
+namespace {
+
+// Rows per task when the raw scores of the training and validation rows
+// are updated, and rows walked through all trees together by prediction.
+constexpr std::size_t boosting_block_rows = 4096;
+constexpr std::size_t boosting_predict_rows = 256;
+
+// Floor on hessians, so a saturated probability cannot zero a leaf's
+// denominator when lambda is 0.
+constexpr double min_hessian = 1e-16;
+
+// fn(first, count) for consecutive blocks of block rows, on pool.
+template <typename Fn>
+void for_each_row_block(mlpp::parallel::ThreadPool& pool, std::size_t rows, std::size_t block, Fn&& fn) {
+    pool.parallel_for((rows + block - 1) / block, [&](std::size_t b) {
+        const std::size_t first = b * block;
+        fn(first, std::min(block, rows - first));
+    });
+}
+
+inline double sigmoid(double z) {
+    return 1.0 / (1.0 + std::exp(-z));
+}
+
+// Replace the K scores at z by their softmax.
+inline void softmax(double* z, std::size_t K) {
+    const double top = *std::max_element(z, z + K);
+    double sum = 0.0;
+    for (std::size_t k = 0; k < K; ++k) {
+        z[k] = std::exp(z[k] - top);
+        sum += z[k];
+    }
+    for (std::size_t k = 0; k < K; ++k) z[k] /= sum;
+}
+
+inline void check_boosting_data(const std::vector<std::vector<double>>& X,
+                                std::size_t n_labels,
+                                const std::vector<std::vector<double>>* X_val,
+                                std::size_t n_val_labels,
+                                const GradientBoostingOptions& options) {
+    if (X.empty() || X.size() != n_labels || X[0].empty())
+        throw std::invalid_argument("Invalid input data");
+    if (X_val && (X_val->empty() || X_val->size() != n_val_labels || (*X_val)[0].size() != X[0].size()))
+        throw std::invalid_argument("Invalid validation data");
+    if (options.n_estimators == 0)
+        throw std::invalid_argument("n_estimators must be positive");
+    if (!(options.learning_rate > 0.0))
+        throw std::invalid_argument("learning_rate must be positive");
+    if (!(options.subsample > 0.0 && options.subsample <= 1.0) ||
+        !(options.colsample > 0.0 && options.colsample <= 1.0))
+        throw std::invalid_argument("subsample and colsample must be in (0, 1]");
+}
+
+}  // anonymous namespace
+
+GradientBoosting::GradientBoosting(GradientBoostingOptions options)
+    : options_(options) {}
+
+template <typename Gradient, typename Loss>
+void GradientBoosting::boost(const Matrix& X,
+                             std::size_t outputs,
+                             std::vector<double> base,
+                             Gradient&& gradient,
+                             const Matrix* X_val,
+                             Loss&& loss) {
+    const std::size_t n = X.size();
+    const std::size_t K = outputs;
+    const double rate = options_.learning_rate;
+
+    const auto fraction = [](double f, std::size_t total) {
+        return std::clamp<std::size_t>(static_cast<std::size_t>(std::ceil(f * total)), 1, total);
+    };
+    const std::size_t m = fraction(options_.subsample, n);
+    const std::size_t max_features = options_.colsample < 1.0 ? fraction(options_.colsample, X[0].size()) : 0;
+
+    outputs_ = K;
+    base_score_ = std::move(base);
+    trees_.clear();
+    trees_.reserve(options_.n_estimators * K);
+    validation_loss_.clear();
+
+    const FeatureBins bins(X, options_.max_bins);
+    if (!pool_)
+        pool_ = std::make_shared<mlpp::parallel::ThreadPool>(mlpp::parallel::resolve_threads(options_.threads) - 1);
+    mlpp::parallel::ThreadPool& pool = *pool_;
+
+    std::vector<double> F(n * K), F_val(X_val ? X_val->size() * K : 0);
+    for (std::size_t i = 0; i < F.size(); ++i) F[i] = base_score_[i % K];
+    for (std::size_t i = 0; i < F_val.size(); ++i) F_val[i] = base_score_[i % K];
+
+    std::vector<std::vector<double>> g(K, std::vector<double>(n)), h(K, std::vector<double>(n));
+
+    std::vector<std::size_t> rows(n), sample;
+    std::iota(rows.begin(), rows.end(), 0);
+    if (m == n) sample = rows;
+
+    // Add the learning rate times the leaves of tree to column k of the
+    // raw scores of the rows of A.
+    const auto add_tree = [&](const DecisionTreeRegressor& tree, std::size_t k, const Matrix& A,
+                              std::vector<double>& scores) {
+        for_each_row_block(pool, A.size(), boosting_block_rows, [&](std::size_t first, std::size_t count) {
+            std::vector<std::uint32_t> leaves(count);
+            tree.flat().leaves_of(count, [&](std::size_t r) { return A[first + r].data(); }, leaves.data());
+            for (std::size_t r = 0; r < count; ++r)
+                scores[(first + r) * K + k] += rate * tree.flat().leaf_value(leaves[r]);
+        });
+    };
+
+    double best_loss = std::numeric_limits<double>::infinity();
+    std::size_t best_rounds = 0;
+
+    for (std::size_t round = 0; round < options_.n_estimators; ++round) {
+        for_each_row_block(pool, n, boosting_block_rows, [&](std::size_t first, std::size_t count) {
+            for (std::size_t i = first; i < first + count; ++i) gradient(i, &F[i * K], g, h);
+        });
+
+        // Partial Fisher-Yates shuffle; continuing from the previous
+        // round's order still draws a uniform subset.
+        if (m < n) {
+            std::mt19937_64 rng(mix_seed(options_.seed, 2 * round));
+            for (std::size_t j = 0; j < m; ++j) {
+                std::uniform_int_distribution<std::size_t> pick(j, n - 1);
+                std::swap(rows[j], rows[pick(rng)]);
+            }
+            sample.assign(rows.begin(), rows.begin() + m);
+            std::sort(sample.begin(), sample.end());
+        }
+
+        for (std::size_t k = 0; k < K; ++k) {
+            DecisionTreeRegressor tree(DecisionTree::Criterion::mse, options_.max_depth, 2,
+                                       options_.min_samples_leaf, options_.min_split_gain, options_.threads, 0,
+                                       max_features, mix_seed(options_.seed, 2 * (round * K + k) + 1));
+            tree.fit_gradients(bins, g[k], h[k], sample, options_.lambda, pool);
+
+            add_tree(tree, k, X, F);
+            if (X_val) add_tree(tree, k, *X_val, F_val);
+            trees_.push_back(std::move(tree));
+        }
+
+        if (!X_val) continue;
+
+        const double l = loss(F_val);
+        validation_loss_.push_back(l);
+        if (l < best_loss) {
+            best_loss = l;
+            best_rounds = round + 1;
+        } else if (options_.early_stopping_rounds != 0 && round + 1 - best_rounds >= options_.early_stopping_rounds) {
+            break;
+        }
+    }
+
+    if (X_val && options_.early_stopping_rounds != 0 && best_rounds != 0)
+        trees_.erase(trees_.begin() + best_rounds * K, trees_.end());
+}
+
+template <typename Row>
+void GradientBoosting::raw_scores(std::size_t count, Row&& row, double* out) const {
+    if (trees_.empty()) throw std::runtime_error("Model not fitted");
+
+    const std::size_t K = outputs_;
+    const double rate = options_.learning_rate;
+    for (std::size_t i = 0; i < count * K; ++i) out[i] = base_score_[i % K];
+    if (count == 0) return;
+
+    for_each_row_block(*pool_, count, boosting_predict_rows, [&](std::size_t first, std::size_t m) {
+        std::uint32_t leaves[boosting_predict_rows];
+        for (std::size_t t = 0; t < trees_.size(); ++t) {
+            const FlatTree& tree = trees_[t].flat();
+            tree.leaves_of(m, [&](std::size_t r) { return row(first + r); }, leaves);
+            for (std::size_t r = 0; r < m; ++r) out[(first + r) * K + t % K] += rate * tree.leaf_value(leaves[r]);
+        }
+    });
+}
+
+// ---------------------------------------------------------------------------
+// Regression
+// ---------------------------------------------------------------------------
+
+GradientBoostingRegressor::GradientBoostingRegressor(GradientBoostingOptions options)
+    : GradientBoosting(options) {}
+
+void GradientBoostingRegressor::fit(const std::vector<std::vector<double>>& X,
+                                    const std::vector<double>& y) {
+    fit_rows(X, y, nullptr, nullptr);
+}
+
+void GradientBoostingRegressor::fit(const std::vector<std::vector<double>>& X,
+                                    const std::vector<double>& y,
+                                    const std::vector<std::vector<double>>& X_val,
+                                    const std::vector<double>& y_val) {
+    fit_rows(X, y, &X_val, &y_val);
+}
+
+void GradientBoostingRegressor::fit_rows(const std::vector<std::vector<double>>& X,
+                                         const std::vector<double>& y,
+                                         const std::vector<std::vector<double>>* X_val,
+                                         const std::vector<double>* y_val) {
+    check_boosting_data(X, y.size(), X_val, y_val ? y_val->size() : 0, options_);
+
+    const double mean = std::accumulate(y.begin(), y.end(), 0.0) / y.size();
+
+    // Squared error ½ (F − y)²: g = F − y, h = 1.
+    boost(X, 1, {mean},
+          [&](std::size_t i, const double* F, std::vector<std::vector<double>>& g,
+              std::vector<std::vector<double>>& h) {
+              g[0][i] = F[0] - y[i];
+              h[0][i] = 1.0;
+          },
+          X_val,
+          [&](const std::vector<double>& F_val) { return mlpp::losses::mse(*y_val, F_val); });
+}
+
+double GradientBoostingRegressor::predict(const std::vector<double>& x) const {
+    double pred;
+    raw_scores(1, [&](std::size_t) { return x.data(); }, &pred);
+    return pred;
+}
+
+std::vector<double> GradientBoostingRegressor::predict(const std::vector<std::vector<double>>& X) const {
+    std::vector<double> preds(X.size());
+    raw_scores(X.size(), [&](std::size_t r) { return X[r].data(); }, preds.data());
+    return preds;
+}
+
+void GradientBoostingRegressor::predict_batch(const double* X,
+                                              std::size_t rows,
+                                              std::size_t cols,
+                                              double* out) const {
+    raw_scores(rows, [&](std::size_t r) { return X + r * cols; }, out);
+}
+
+// ---------------------------------------------------------------------------
+// Classification
+// ---------------------------------------------------------------------------
+
+GradientBoostingClassifier::GradientBoostingClassifier(GradientBoostingOptions options)
+    : GradientBoosting(options) {}
+
+void GradientBoostingClassifier::fit(const std::vector<std::vector<double>>& X,
+                                     const std::vector<std::string>& y) {
+    if (X.empty() || X.size() != y.size())
+        throw std::invalid_argument("X and y size mismatch");
+    set_class_labels(y, code_to_label_, label_to_code_);
+
+    fit_codes(X, codes_of(y), nullptr, nullptr);
+}
+
+void GradientBoostingClassifier::fit(const std::vector<std::vector<double>>& X,
+                                     const std::vector<std::string>& y,
+                                     const std::vector<std::vector<double>>& X_val,
+                                     const std::vector<std::string>& y_val) {
+    if (X.empty() || X.size() != y.size())
+        throw std::invalid_argument("X and y size mismatch");
+    set_class_labels(y, code_to_label_, label_to_code_);
+
+    const std::vector<double> codes_val = codes_of(y_val);
+    fit_codes(X, codes_of(y), &X_val, &codes_val);
+}
+
+void GradientBoostingClassifier::fit(const std::vector<std::vector<double>>& X,
+                                     const std::vector<double>& y) {
+    set_class_codes(y, code_to_label_, label_to_code_);
+    fit_codes(X, y, nullptr, nullptr);
+}
+
+void GradientBoostingClassifier::fit(const std::vector<std::vector<double>>& X,
+                                     const std::vector<double>& y,
+                                     const std::vector<std::vector<double>>& X_val,
+                                     const std::vector<double>& y_val) {
+    set_class_codes(y, code_to_label_, label_to_code_);
+    for (double v : y_val) {
+        if (v < 0.0 || v != std::floor(v) || v >= static_cast<double>(code_to_label_.size()))
+            throw std::invalid_argument("Validation class code not seen in training");
+    }
+    fit_codes(X, y, &X_val, &y_val);
+}
+
+std::vector<double> GradientBoostingClassifier::codes_of(const std::vector<std::string>& y) const {
+    std::vector<double> codes(y.size());
+    for (std::size_t i = 0; i < y.size(); ++i) {
+        auto it = label_to_code_.find(y[i]);
+        if (it == label_to_code_.end()) throw std::invalid_argument("Unknown class label: " + y[i]);
+        codes[i] = it->second;
+    }
+    return codes;
+}
+
+void GradientBoostingClassifier::fit_codes(const std::vector<std::vector<double>>& X,
+                                           const std::vector<double>& y,
+                                           const std::vector<std::vector<double>>* X_val,
+                                           const std::vector<double>* y_val) {
+    check_boosting_data(X, y.size(), X_val, y_val ? y_val->size() : 0, options_);
+
+    const std::size_t n = X.size();
+    const std::size_t K = code_to_label_.size();
+    if (K < 2) throw std::invalid_argument("Need at least two classes");
+
+    // Start from the log-odds of the class frequencies.
+    std::vector<double> prior(K, 0.0);
+    for (double v : y) prior[static_cast<std::size_t>(v)] += 1.0;
+    for (double& p : prior) p = std::clamp(p / n, 1e-12, 1.0 - 1e-12);
+
+    if (K == 2) {
+        // Log-loss of p = σ(F): g = p − y, h = p (1 − p).
+        boost(X, 1, {std::log(prior[1] / prior[0])},
+              [&](std::size_t i, const double* F, std::vector<std::vector<double>>& g,
+                  std::vector<std::vector<double>>& h) {
+                  const double p = sigmoid(F[0]);
+                  g[0][i] = p - y[i];
+                  h[0][i] = std::max(p * (1.0 - p), min_hessian);
+              },
+              X_val,
+              [&](const std::vector<double>& F_val) {
+                  std::vector<double> p(F_val.size());
+                  for (std::size_t r = 0; r < p.size(); ++r) p[r] = sigmoid(F_val[r]);
+                  return mlpp::losses::binary_cross_entropy(*y_val, p);
+              });
+        return;
+    }
+
+    std::vector<double> base(K);
+    for (std::size_t k = 0; k < K; ++k) base[k] = std::log(prior[k]);
+
+    std::vector<std::vector<double>> one_hot;
+    if (y_val) {
+        one_hot.assign(y_val->size(), std::vector<double>(K, 0.0));
+        for (std::size_t r = 0; r < y_val->size(); ++r) one_hot[r][static_cast<std::size_t>((*y_val)[r])] = 1.0;
+    }
+
+    // Softmax cross-entropy: g_k = p_k − [y = k], h_k = p_k (1 − p_k).
+    boost(X, K, std::move(base),
+          [&](std::size_t i, const double* F, std::vector<std::vector<double>>& g,
+              std::vector<std::vector<double>>& h) {
+              const double top = *std::max_element(F, F + K);
+              double sum = 0.0;
+              for (std::size_t k = 0; k < K; ++k) sum += std::exp(F[k] - top);
+              for (std::size_t k = 0; k < K; ++k) {
+                  const double p = std::exp(F[k] - top) / sum;
+                  g[k][i] = p - (static_cast<std::size_t>(y[i]) == k ? 1.0 : 0.0);
+                  h[k][i] = std::max(p * (1.0 - p), min_hessian);
+              }
+          },
+          X_val,
+          [&](const std::vector<double>& F_val) {
+              std::vector<std::vector<double>> p(one_hot.size());
+              for (std::size_t r = 0; r < p.size(); ++r) {
+                  p[r].assign(F_val.begin() + r * K, F_val.begin() + (r + 1) * K);
+                  softmax(p[r].data(), K);
+              }
+              return mlpp::losses::multiclass_cross_entropy(one_hot, p);
+          });
+}
+
+template <typename Row>
+void GradientBoostingClassifier::probabilities(std::size_t count, Row&& row, double* out) const {
+    const std::size_t K = code_to_label_.size();
+
+    if (outputs_ == 1) {
+        std::vector<double> z(count);
+        raw_scores(count, row, z.data());
+        for (std::size_t r = 0; r < count; ++r) {
+            out[2 * r + 1] = sigmoid(z[r]);
+            out[2 * r] = 1.0 - out[2 * r + 1];
+        }
+        return;
+    }
+
+    raw_scores(count, row, out);
+    for (std::size_t r = 0; r < count; ++r) softmax(out + r * K, K);
+}
+
+double GradientBoostingClassifier::predict(const std::vector<double>& x) const {
+    const std::vector<double> proba = predict_proba(x);
+    return static_cast<double>(std::max_element(proba.begin(), proba.end()) - proba.begin());
+}
+
+std::vector<double> GradientBoostingClassifier::predict(const std::vector<std::vector<double>>& X) const {
+    const std::size_t K = code_to_label_.size();
+    std::vector<double> proba(X.size() * K);
+    probabilities(X.size(), [&](std::size_t r) { return X[r].data(); }, proba.data());
+
+    std::vector<double> preds(X.size());
+    for (std::size_t i = 0; i < X.size(); ++i) {
+        const double* p = &proba[i * K];
+        preds[i] = static_cast<double>(std::max_element(p, p + K) - p);
+    }
+    return preds;
+}
+
+std::string GradientBoostingClassifier::predict_class(const std::vector<double>& x) const {
+    return code_to_label_[static_cast<std::size_t>(predict(x))];
+}
+
+std::vector<std::string> GradientBoostingClassifier::predict_class(const std::vector<std::vector<double>>& X) const {
+    const std::vector<double> codes = predict(X);
+    std::vector<std::string> preds(X.size());
+    for (std::size_t i = 0; i < X.size(); ++i) preds[i] = code_to_label_[static_cast<std::size_t>(codes[i])];
+    return preds;
+}
+
+std::vector<double> GradientBoostingClassifier::predict_proba(const std::vector<double>& x) const {
+    std::vector<double> proba(code_to_label_.size());
+    probabilities(1, [&](std::size_t) { return x.data(); }, proba.data());
+    return proba;
+}
+
+void GradientBoostingClassifier::predict_proba_batch(const double* X,
+                                                     std::size_t rows,
+                                                     std::size_t cols,
+                                                     double* out) const {
+    probabilities(rows, [&](std::size_t r) { return X + r * cols; }, out);
+}
+
+void GradientBoostingClassifier::predict_batch(const double* X,
+                                               std::size_t rows,
+                                               std::size_t cols,
+                                               double* out) const {
+    const std::size_t K = code_to_label_.size();
+    std::vector<double> proba(rows * K);
+    probabilities(rows, [&](std::size_t r) { return X + r * cols; }, proba.data());
+    for (std::size_t i = 0; i < rows; ++i) {
+        const double* p = &proba[i * K];
+        out[i] = static_cast<double>(std::max_element(p, p + K) - p);
+    }
+}
+
+}  // namespace decision_trees
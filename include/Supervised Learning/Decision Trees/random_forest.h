@@ -0,0 +1,148 @@
+// random_forest.h
+#pragma once
+
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <limits>
+#include <unordered_map>
+
+#include "decision_tree.h"
+
+namespace decision_trees {
+
+struct RandomForestOptions {
+    std::size_t n_estimators = 100;
+
+    // Features tried at each split; 0 = √d for classification and all d
+    // features for regression.
+    std::size_t max_features = 0;
+
+    // Fit each tree on a bootstrap sample of the rows instead of all of them.
+    bool bootstrap = true;
+
+    // Score every row with the trees whose bootstrap sample missed it.
+    bool oob_score = false;
+
+    // Growth limits of every tree, see DecisionTree.
+    std::size_t max_depth = std::numeric_limits<std::size_t>::max();
+    std::size_t min_samples_split = 2;
+    std::size_t min_samples_leaf = 1;
+    double min_impurity_decrease = 0.0;
+
+    // Histogram splits over at most this many bins (0 = exact); the
+    // features are binned once and the bins shared by all trees.
+    std::size_t max_bins = 0;
+
+    std::size_t threads = 0;  // 0 = all hardware threads
+    std::uint64_t seed = 0;
+};
+
+// Forests of randomised trees.
+//
+// Trees are independent, so each is one task on a thread pool and is
+// built single-threaded. A tree is fully determined by the forest seed
+// and its index: its bootstrap sample and its per-node feature draws come
+// from per-tree seeds, so the forest does not depend on the thread count.
+// Bootstrap samples are index lists into the caller's X; rows are never
+// copied. Out-of-bag predictions are accumulated as soon as each tree is
+// done, from that tree's rows outside its sample.
+//
+// Prediction walks blocks of rows through every tree in turn, adding up
+// the leaves into the block's slice of the output while it is in cache.
+
+class RandomForestClassifier {
+public:
+    explicit RandomForestClassifier(DecisionTree::Criterion criterion = DecisionTree::Criterion::gini,
+                                    RandomForestOptions options = {});
+
+    void fit(const std::vector<std::vector<double>>& X,
+             const std::vector<std::string>& y);
+
+    // y holds class codes: non-negative integers, named "0", "1", ...
+    void fit(const std::vector<std::vector<double>>& X,
+             const std::vector<double>& y);
+
+    // Class code with the highest mean probability.
+    double predict(const std::vector<double>& x) const;
+    std::vector<double> predict(const std::vector<std::vector<double>>& X) const;
+
+    std::string predict_class(const std::vector<double>& x) const;
+    std::vector<std::string> predict_class(const std::vector<std::vector<double>>& X) const;
+
+    // Mean of the trees' class probabilities.
+    std::vector<double> predict_proba(const std::vector<double>& x) const;
+
+    // Probabilities of rows samples stored row-major, cols values per row,
+    // written to out as rows × classes().size().
+    void predict_proba_batch(const double* X, std::size_t rows, std::size_t cols, double* out) const;
+
+    // Class codes of rows samples stored row-major, written to out.
+    void predict_batch(const double* X, std::size_t rows, std::size_t cols, double* out) const;
+
+    // Accuracy of the out-of-bag predictions over the rows that have any.
+    double oob_score() const;
+
+    const std::vector<std::string>& classes() const noexcept { return code_to_label_; }
+    const std::vector<DecisionTreeClassifier>& trees() const noexcept { return trees_; }
+
+private:
+    void fit_codes(const std::vector<std::vector<double>>& X,
+                   const std::vector<double>& y);
+
+    // Sum of the trees' probabilities of count rows into out (count × K).
+    template <typename Row>
+    void accumulate(std::size_t count, Row&& row, double* out) const;
+
+    DecisionTree::Criterion criterion_;
+    RandomForestOptions options_;
+
+    std::vector<DecisionTreeClassifier> trees_;
+    std::vector<std::string> code_to_label_;
+    std::unordered_map<std::string, double> label_to_code_;
+    double oob_score_{std::numeric_limits<double>::quiet_NaN()};
+
+    // Pool of options_.threads threads, created by the first fit() and
+    // kept for prediction.
+    std::shared_ptr<mlpp::parallel::ThreadPool> pool_;
+};
+
+class RandomForestRegressor {
+public:
+    explicit RandomForestRegressor(DecisionTree::Criterion criterion = DecisionTree::Criterion::mse,
+                                   RandomForestOptions options = {});
+
+    void fit(const std::vector<std::vector<double>>& X,
+             const std::vector<double>& y);
+
+    // Mean of the trees' predictions.
+    double predict(const std::vector<double>& x) const;
+    std::vector<double> predict(const std::vector<std::vector<double>>& X) const;
+
+    // Predictions of rows samples stored row-major, written to out.
+    void predict_batch(const double* X, std::size_t rows, std::size_t cols, double* out) const;
+
+    // R² of the out-of-bag predictions over the rows that have any.
+    double oob_score() const;
+
+    const std::vector<DecisionTreeRegressor>& trees() const noexcept { return trees_; }
+
+private:
+    // Sum of the trees' predictions of count rows into out.
+    template <typename Row>
+    void accumulate(std::size_t count, Row&& row, double* out) const;
+
+    DecisionTree::Criterion criterion_;
+    RandomForestOptions options_;
+
+    std::vector<DecisionTreeRegressor> trees_;
+    double oob_score_{std::numeric_limits<double>::quiet_NaN()};
+
+    // Pool of options_.threads threads, created by the first fit() and
+    // kept for prediction.
+    std::shared_ptr<mlpp::parallel::ThreadPool> pool_;
+};
+
+}  // namespace decision_trees
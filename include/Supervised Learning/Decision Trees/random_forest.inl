@@ -0,0 +1,358 @@
+// random_forest.inl
+
+#include "random_forest.h"
+
+#include <mutex>
+
+namespace decision_trees {
+
+namespace {
+
+// Rows walked through all trees together by forest prediction.
+constexpr std::size_t forest_block_rows = 256;
+
+// Rows a tree is fit on (n draws with replacement, or all rows) and the
+// out-of-bag rows its sample missed.
+inline void draw_sample(std::size_t n,
+                        bool bootstrap,
+                        std::uint64_t seed,
+                        std::vector<std::size_t>& sample,
+                        std::vector<std::size_t>& oob) {
+    sample.resize(n);
+    if (!bootstrap) {
+        std::iota(sample.begin(), sample.end(), 0);
+        return;
+    }
+
+    std::mt19937_64 rng(seed);
+    std::uniform_int_distribution<std::size_t> pick(0, n - 1);
+    std::vector<bool> drawn(n, false);
+    for (std::size_t& i : sample) {
+        i = pick(rng);
+        drawn[i] = true;
+    }
+
+    for (std::size_t i = 0; i < n; ++i) {
+        if (!drawn[i]) oob.push_back(i);
+    }
+}
+
+// fn(first, count) for consecutive blocks of rows, on pool.
+template <typename Fn>
+void for_each_block(mlpp::parallel::ThreadPool& pool, std::size_t rows, Fn&& fn) {
+    pool.parallel_for((rows + forest_block_rows - 1) / forest_block_rows, [&](std::size_t b) {
+        const std::size_t first = b * forest_block_rows;
+        fn(first, std::min(forest_block_rows, rows - first));
+    });
+}
+
+inline void check_forest_data(const std::vector<std::vector<double>>& X,
+                              std::size_t n_labels,
+                              const RandomForestOptions& options) {
+    if (X.empty() || X.size() != n_labels || X[0].empty())
+        throw std::invalid_argument("Invalid input data");
+    if (options.n_estimators == 0)
+        throw std::invalid_argument("n_estimators must be positive");
+}
+
+}  // anonymous namespace
+
+RandomForestClassifier::RandomForestClassifier(DecisionTree::Criterion criterion, RandomForestOptions options)
+    : criterion_(criterion),
+      options_(options) {
+    if (criterion_ != DecisionTree::Criterion::gini && criterion_ != DecisionTree::Criterion::entropy) {
+        throw std::invalid_argument("Invalid criterion for classifier");
+    }
+}
+
+void RandomForestClassifier::fit(const std::vector<std::vector<double>>& X,
+                                 const std::vector<std::string>& y) {
+    if (X.empty() || X.size() != y.size())
+        throw std::invalid_argument("X and y size mismatch");
+
+    set_class_labels(y, code_to_label_, label_to_code_);
+
+    std::vector<double> y_num(y.size());
+    for (std::size_t i = 0; i < y.size(); ++i) y_num[i] = label_to_code_.at(y[i]);
+
+    fit_codes(X, y_num);
+}
+
+void RandomForestClassifier::fit(const std::vector<std::vector<double>>& X,
+                                 const std::vector<double>& y) {
+    if (X.empty() || X.size() != y.size())
+        throw std::invalid_argument("X and y size mismatch");
+
+    set_class_codes(y, code_to_label_, label_to_code_);
+    fit_codes(X, y);
+}
+
+void RandomForestClassifier::fit_codes(const std::vector<std::vector<double>>& X,
+                                       const std::vector<double>& y) {
+    check_forest_data(X, y.size(), options_);
+
+    const std::size_t n = X.size();
+    const std::size_t K = code_to_label_.size();
+    const std::size_t T = options_.n_estimators;
+    const std::size_t max_features = options_.max_features != 0
+        ? options_.max_features
+        : std::max<std::size_t>(1, static_cast<std::size_t>(std::sqrt(static_cast<double>(X[0].size()))));
+
+    std::optional<FeatureBins> bins;
+    if (options_.max_bins != 0) bins.emplace(X, options_.max_bins);
+
+    trees_.clear();
+    trees_.reserve(T);
+    for (std::size_t t = 0; t < T; ++t) {
+        trees_.emplace_back(criterion_, options_.max_depth, options_.min_samples_split, options_.min_samples_leaf,
+                            options_.min_impurity_decrease, 1, options_.max_bins, max_features,
+                            mix_seed(options_.seed, 2 * t + 1));
+    }
+
+    const bool oob_score = options_.oob_score && options_.bootstrap;
+    std::vector<double> oob_proba(oob_score ? n * K : 0, 0.0);
+    std::mutex oob_mutex;
+
+    if (!pool_)
+        pool_ = std::make_shared<mlpp::parallel::ThreadPool>(mlpp::parallel::resolve_threads(options_.threads) - 1);
+
+    pool_->parallel_for(T, [&](std::size_t t) {
+        std::vector<std::size_t> sample, oob;
+        draw_sample(n, options_.bootstrap, mix_seed(options_.seed, 2 * t), sample, oob);
+
+        DecisionTreeClassifier& tree = trees_[t];
+        tree.fit(X, y, sample, bins ? &*bins : nullptr);
+
+        if (!oob_score || oob.empty()) return;
+
+        std::vector<std::uint32_t> leaves(oob.size());
+        tree.flat().leaves_of(oob.size(), [&](std::size_t r) { return X[oob[r]].data(); }, leaves.data());
+
+        const std::lock_guard lock(oob_mutex);
+        for (std::size_t r = 0; r < oob.size(); ++r) {
+            const double* p = tree.flat().leaf_proba(leaves[r]);
+            double* o = &oob_proba[oob[r] * K];
+            for (std::size_t k = 0; k < K; ++k) o[k] += p[k];
+        }
+    });
+
+    oob_score_ = std::numeric_limits<double>::quiet_NaN();
+    if (!oob_score) return;
+
+    // Each tree adds probabilities summing to one, so a row has out-of-bag
+    // votes exactly when its sum is positive.
+    std::size_t scored = 0, correct = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const double* p = &oob_proba[i * K];
+        if (std::accumulate(p, p + K, 0.0) <= 0.0) continue;
+        ++scored;
+        correct += static_cast<double>(std::max_element(p, p + K) - p) == y[i];
+    }
+    if (scored != 0) oob_score_ = static_cast<double>(correct) / scored;
+}
+
+template <typename Row>
+void RandomForestClassifier::accumulate(std::size_t count, Row&& row, double* out) const {
+    if (trees_.empty()) throw std::runtime_error("Forest not fitted");
+
+    const std::size_t K = code_to_label_.size();
+    std::fill(out, out + count * K, 0.0);
+
+    for_each_block(*pool_, count, [&](std::size_t first, std::size_t m) {
+        std::uint32_t leaves[forest_block_rows];
+        for (const DecisionTreeClassifier& tree : trees_) {
+            tree.flat().leaves_of(m, [&](std::size_t r) { return row(first + r); }, leaves);
+            for (std::size_t r = 0; r < m; ++r) {
+                const double* p = tree.flat().leaf_proba(leaves[r]);
+                double* o = out + (first + r) * K;
+                for (std::size_t k = 0; k < K; ++k) o[k] += p[k];
+            }
+        }
+    });
+}
+
+double RandomForestClassifier::predict(const std::vector<double>& x) const {
+    const std::vector<double> proba = predict_proba(x);
+    return static_cast<double>(std::max_element(proba.begin(), proba.end()) - proba.begin());
+}
+
+std::vector<double> RandomForestClassifier::predict(const std::vector<std::vector<double>>& X) const {
+    const std::size_t K = code_to_label_.size();
+    std::vector<double> proba(X.size() * K);
+    accumulate(X.size(), [&](std::size_t r) { return X[r].data(); }, proba.data());
+
+    std::vector<double> preds(X.size());
+    for (std::size_t i = 0; i < X.size(); ++i) {
+        const double* p = &proba[i * K];
+        preds[i] = static_cast<double>(std::max_element(p, p + K) - p);
+    }
+    return preds;
+}
+
+std::string RandomForestClassifier::predict_class(const std::vector<double>& x) const {
+    return code_to_label_[static_cast<std::size_t>(predict(x))];
+}
+
+std::vector<std::string> RandomForestClassifier::predict_class(const std::vector<std::vector<double>>& X) const {
+    const std::vector<double> codes = predict(X);
+    std::vector<std::string> preds(X.size());
+    for (std::size_t i = 0; i < X.size(); ++i) preds[i] = code_to_label_[static_cast<std::size_t>(codes[i])];
+    return preds;
+}
+
+std::vector<double> RandomForestClassifier::predict_proba(const std::vector<double>& x) const {
+    std::vector<double> proba(code_to_label_.size());
+    accumulate(1, [&](std::size_t) { return x.data(); }, proba.data());
+    for (double& p : proba) p /= trees_.size();
+    return proba;
+}
+
+void RandomForestClassifier::predict_proba_batch(const double* X,
+                                                 std::size_t rows,
+                                                 std::size_t cols,
+                                                 double* out) const {
+    accumulate(rows, [&](std::size_t r) { return X + r * cols; }, out);
+    const double scale = 1.0 / trees_.size();
+    for (std::size_t k = 0; k < rows * code_to_label_.size(); ++k) out[k] *= scale;
+}
+
+void RandomForestClassifier::predict_batch(const double* X,
+                                           std::size_t rows,
+                                           std::size_t cols,
+                                           double* out) const {
+    const std::size_t K = code_to_label_.size();
+    std::vector<double> proba(rows * K);
+    accumulate(rows, [&](std::size_t r) { return X + r * cols; }, proba.data());
+
+    for (std::size_t i = 0; i < rows; ++i) {
+        const double* p = &proba[i * K];
+        out[i] = static_cast<double>(std::max_element(p, p + K) - p);
+    }
+}
+
+double RandomForestClassifier::oob_score() const {
+    if (!options_.oob_score || !options_.bootstrap || trees_.empty())
+        throw std::runtime_error("Out-of-bag score needs a forest fitted with bootstrap and oob_score");
+    return oob_score_;
+}
+
+RandomForestRegressor::RandomForestRegressor(DecisionTree::Criterion criterion, RandomForestOptions options)
+    : criterion_(criterion),
+      options_(options) {
+    if (criterion_ != DecisionTree::Criterion::mse && criterion_ != DecisionTree::Criterion::mae) {
+        throw std::invalid_argument("Invalid criterion for regressor");
+    }
+}
+
+void RandomForestRegressor::fit(const std::vector<std::vector<double>>& X,
+                                const std::vector<double>& y) {
+    check_forest_data(X, y.size(), options_);
+
+    const std::size_t n = X.size();
+    const std::size_t T = options_.n_estimators;
+
+    std::optional<FeatureBins> bins;
+    if (options_.max_bins != 0) bins.emplace(X, options_.max_bins);
+
+    trees_.clear();
+    trees_.reserve(T);
+    for (std::size_t t = 0; t < T; ++t) {
+        trees_.emplace_back(criterion_, options_.max_depth, options_.min_samples_split, options_.min_samples_leaf,
+                            options_.min_impurity_decrease, 1, options_.max_bins, options_.max_features,
+                            mix_seed(options_.seed, 2 * t + 1));
+    }
+
+    const bool oob_score = options_.oob_score && options_.bootstrap;
+    std::vector<double> oob_sum(oob_score ? n : 0, 0.0);
+    std::vector<std::size_t> oob_count(oob_score ? n : 0, 0);
+    std::mutex oob_mutex;
+
+    if (!pool_)
+        pool_ = std::make_shared<mlpp::parallel::ThreadPool>(mlpp::parallel::resolve_threads(options_.threads) - 1);
+
+    pool_->parallel_for(T, [&](std::size_t t) {
+        std::vector<std::size_t> sample, oob;
+        draw_sample(n, options_.bootstrap, mix_seed(options_.seed, 2 * t), sample, oob);
+
+        DecisionTreeRegressor& tree = trees_[t];
+        tree.fit(X, y, sample, bins ? &*bins : nullptr);
+
+        if (!oob_score || oob.empty()) return;
+
+        std::vector<std::uint32_t> leaves(oob.size());
+        tree.flat().leaves_of(oob.size(), [&](std::size_t r) { return X[oob[r]].data(); }, leaves.data());
+
+        const std::lock_guard lock(oob_mutex);
+        for (std::size_t r = 0; r < oob.size(); ++r) {
+            oob_sum[oob[r]] += tree.flat().leaf_value(leaves[r]);
+            ++oob_count[oob[r]];
+        }
+    });
+
+    oob_score_ = std::numeric_limits<double>::quiet_NaN();
+    if (!oob_score) return;
+
+    std::size_t scored = 0;
+    double mean = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        if (oob_count[i] == 0) continue;
+        ++scored;
+        mean += y[i];
+    }
+    if (scored == 0) return;
+    mean /= scored;
+
+    double ss_res = 0.0, ss_tot = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        if (oob_count[i] == 0) continue;
+        const double r = y[i] - oob_sum[i] / oob_count[i];
+        const double d = y[i] - mean;
+        ss_res += r * r;
+        ss_tot += d * d;
+    }
+    oob_score_ = ss_tot > 0.0 ? 1.0 - ss_res / ss_tot : 0.0;
+}
+
+template <typename Row>
+void RandomForestRegressor::accumulate(std::size_t count, Row&& row, double* out) const {
+    if (trees_.empty()) throw std::runtime_error("Forest not fitted");
+
+    std::fill(out, out + count, 0.0);
+
+    for_each_block(*pool_, count, [&](std::size_t first, std::size_t m) {
+        std::uint32_t leaves[forest_block_rows];
+        for (const DecisionTreeRegressor& tree : trees_) {
+            tree.flat().leaves_of(m, [&](std::size_t r) { return row(first + r); }, leaves);
+            for (std::size_t r = 0; r < m; ++r) out[first + r] += tree.flat().leaf_value(leaves[r]);
+        }
+    });
+}
+
+double RandomForestRegressor::predict(const std::vector<double>& x) const {
+    double sum = 0.0;
+    accumulate(1, [&](std::size_t) { return x.data(); }, &sum);
+    return sum / trees_.size();
+}
+
+std::vector<double> RandomForestRegressor::predict(const std::vector<std::vector<double>>& X) const {
+    std::vector<double> preds(X.size());
+    accumulate(X.size(), [&](std::size_t r) { return X[r].data(); }, preds.data());
+    for (double& p : preds) p /= trees_.size();
+    return preds;
+}
+
+void RandomForestRegressor::predict_batch(const double* X,
+                                          std::size_t rows,
+                                          std::size_t cols,
+                                          double* out) const {
+    accumulate(rows, [&](std::size_t r) { return X + r * cols; }, out);
+    for (std::size_t i = 0; i < rows; ++i) out[i] /= trees_.size();
+}
+
+double RandomForestRegressor::oob_score() const {
+    if (!options_.oob_score || !options_.bootstrap || trees_.empty())
+        throw std::runtime_error("Out-of-bag score needs a forest fitted with bootstrap and oob_score");
+    return oob_score_;
+}
+
+}  // namespace decision_trees
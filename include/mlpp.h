@@ -11,7 +11,14 @@
 #include "Supervised Learning/Classifiers/logistic_regression.h"
 #include "Supervised Learning/Classifiers/MDC.h"
 #include "Supervised Learning/Classifiers/SVM/SVM.hpp"
+#include "Supervised Learning/Classifiers/SVM/multiclass_svm.hpp"
+#include "Supervised Learning/Classifiers/SVM/feature_maps.hpp"
+#include "Supervised Learning/Classifiers/SVM/linear_svm.hpp"
+#include "Supervised Learning/Classifiers/SVM/svm_search.hpp"
+#include "Supervised Learning/Classifiers/SVM/Kernel Perceptron/budget_perceptron.hpp"
 #include "Supervised Learning/Decision Trees/decision_tree.h"
+#include "Supervised Learning/Decision Trees/random_forest.h"
+#include "Supervised Learning/Decision Trees/gradient_boosting.h"
 #include "Supervised Learning/Regression/linear_regression.hpp"
 #include "Supervised Learning/Regression/ridge_regression.h"
 